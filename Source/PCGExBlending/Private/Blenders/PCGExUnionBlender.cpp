@@ -158,7 +158,7 @@ namespace PCGExBlending
 
 			EnumAddFlags(AllocatedProperties, Facade->GetAllocations());
 
-			UniqueTags.Append(Facade->Source->Tags->RawTags);
+			for (const PCGExData::FTagId& Tag : Facade->Source->Tags->GetRawTags_Unsafe()) { UniqueTags.Add(PCGExData::FTagTable::ToString(Tag)); }
 
 			TArray<PCGExData::FAttributeIdentity> SourceAttributes;
 			GetFilteredIdentities(Facade->GetIn()->Metadata, SourceAttributes, BlendingDetails, CarryOverDetails, IgnoreAttributeSet);
@@ -75,6 +75,38 @@ namespace PCGExAssetCollection
 		return WeightSum;
 	}
 
+	// Guide table over the cumulative Weights: Guide[b] is the first slot whose cumulative weight
+	// exceeds the start of bucket b, with one bucket per entry. A weighted pick jumps to its bucket
+	// and scans forward, which averages under two steps regardless of the entry count.
+	static void CompileGuide(const TArray<int32>& Weights, const double WeightSum, TArray<int32>& Guide)
+	{
+		const int32 NumBuckets = Weights.Num();
+		const int64 Total = static_cast<int64>(WeightSum);
+
+		Guide.SetNumUninitialized(NumBuckets);
+
+		int32 Slot = 0;
+		for (int32 b = 0; b < NumBuckets; b++)
+		{
+			const int64 BucketStart = (b * Total) / NumBuckets;
+			while (Slot < NumBuckets - 1 && Weights[Slot] <= BucketStart) { Slot++; }
+			Guide[b] = Slot;
+		}
+	}
+
+	// Returns the first slot whose cumulative weight exceeds the seeded threshold,
+	// i.e. the exact same slot a linear scan over Weights would land on.
+	static int32 PickWeightedSlot(const TArray<int32>& Weights, const TArray<int32>& Guide, const double WeightSum, const int32 Seed)
+	{
+		const int32 Total = static_cast<int32>(WeightSum);
+		const int32 Threshold = FRandomStream(Seed).RandRange(0, Total - 1);
+		const int32 Last = Weights.Num() - 1;
+
+		int32 Pick = Guide[FMath::Clamp(static_cast<int32>((static_cast<int64>(Threshold) * Guide.Num()) / Total), 0, Last)];
+		while (Pick < Last && Weights[Pick] <= Threshold) { Pick++; }
+		return Pick;
+	}
+
 #pragma region FMicroCache
 
 	int32 FMicroCache::GetPick(int32 Index, EPCGExIndexPickMode PickMode) const
@@ -125,10 +157,7 @@ namespace PCGExAssetCollection
 			return -1;
 		}
 
-		const int32 Threshold = FRandomStream(Seed).RandRange(0, static_cast<int32>(WeightSum) - 1);
-		int32 Pick = 0;
-		while (Pick < Weights.Num() && Weights[Pick] <= Threshold) { Pick++; }
-		return Order[FMath::Min(Pick, Order.Num() - 1)];
+		return Order[PickWeightedSlot(Weights, Guide, WeightSum, Seed)];
 	}
 
 	void FMicroCache::BuildFromWeights(TConstArrayView<int32> InWeights)
@@ -142,6 +171,7 @@ namespace PCGExAssetCollection
 		}
 
 		WeightSum = CompileWeightedOrder(Weights, Order);
+		CompileGuide(Weights, WeightSum, Guide);
 	}
 
 #pragma endregion
@@ -189,10 +219,7 @@ namespace PCGExAssetCollection
 	int32 FCategory::GetPickRandomWeighted(int32 Seed) const
 	{
 		if (Order.IsEmpty()) { return -1; }
-		const int32 Threshold = FRandomStream(Seed).RandRange(0, static_cast<int32>(WeightSum) - 1);
-		int32 Pick = 0;
-		while (Pick < Weights.Num() && Weights[Pick] <= Threshold) { Pick++; }
-		return Indices[Order[FMath::Min(Pick, Order.Num() - 1)]];
+		return Indices[Order[PickWeightedSlot(Weights, Guide, WeightSum, Seed)]];
 	}
 
 	void FCategory::Reserve(int32 InNum)
@@ -207,6 +234,7 @@ namespace PCGExAssetCollection
 		Indices.Shrink();
 		Weights.Shrink();
 		Order.Shrink();
+		Guide.Shrink();
 	}
 
 	void FCategory::RegisterEntry(int32 Index, const FPCGExAssetCollectionEntry* InEntry)
@@ -221,6 +249,7 @@ namespace PCGExAssetCollection
 	{
 		Shrink();
 		WeightSum = CompileWeightedOrder(Weights, Order);
+		CompileGuide(Weights, WeightSum, Guide);
 	}
 
 #pragma endregion
@@ -446,10 +475,15 @@ FPCGExEntryAccessResult UPCGExAssetCollection::GetEntryRandom(int32 Seed) const
 }
 
 FPCGExEntryAccessResult UPCGExAssetCollection::GetEntryWeightedRandom(int32 Seed) const
+{
+	return GetEntryWeightedRandom(const_cast<UPCGExAssetCollection*>(this)->LoadCache(), Seed);
+}
+
+FPCGExEntryAccessResult UPCGExAssetCollection::GetEntryWeightedRandom(const PCGExAssetCollection::FCache* InCache, int32 Seed) const
 {
 	FPCGExEntryAccessResult Result;
 
-	const int32 PickedIndex = const_cast<UPCGExAssetCollection*>(this)->LoadCache()->Main->GetPickRandomWeighted(Seed);
+	const int32 PickedIndex = InCache->Main->GetPickRandomWeighted(Seed);
 	const FPCGExAssetCollectionEntry* Entry = GetEntryAtRawIndex(PickedIndex);
 
 	if (!Entry)
@@ -597,10 +631,15 @@ FPCGExEntryAccessResult UPCGExAssetCollection::GetEntryRandom(int32 Seed, uint8
 }
 
 FPCGExEntryAccessResult UPCGExAssetCollection::GetEntryWeightedRandom(int32 Seed, uint8 TagInheritance, TSet<FName>& OutTags) const
+{
+	return GetEntryWeightedRandom(const_cast<UPCGExAssetCollection*>(this)->LoadCache(), Seed, TagInheritance, OutTags);
+}
+
+FPCGExEntryAccessResult UPCGExAssetCollection::GetEntryWeightedRandom(const PCGExAssetCollection::FCache* InCache, int32 Seed, uint8 TagInheritance, TSet<FName>& OutTags) const
 {
 	FPCGExEntryAccessResult Result;
 
-	const int32 PickedIndex = const_cast<UPCGExAssetCollection*>(this)->LoadCache()->Main->GetPickRandomWeighted(Seed);
+	const int32 PickedIndex = InCache->Main->GetPickRandomWeighted(Seed);
 	const FPCGExAssetCollectionEntry* Entry = GetEntryAtRawIndex(PickedIndex);
 
 	if (!Entry)
@@ -57,6 +57,18 @@ bool FPCGExAssetCollectionToSetElement::IsCacheable(const UPCGSettings* InSettin
 	PCGEX_GET_OPTION_STATE(Settings->CacheData, bDefaultCacheNodeOutput)
 }
 
+bool FPCGExAssetCollectionToSetElement::Boot(FPCGExContext* InContext) const
+{
+	if (!IPCGExElement::Boot(InContext)) { return false; }
+
+	PCGEX_SETTINGS_C(InContext, AssetCollectionToSet)
+
+	// Let the collection stream in with the preparation phase rather than blocking in AdvanceWork
+	if (!Settings->AssetCollection.IsNull() && !Settings->AssetCollection.Get()) { InContext->AddAssetDependency(Settings->AssetCollection.ToSoftObjectPath()); }
+
+	return true;
+}
+
 bool FPCGExAssetCollectionToSetElement::AdvanceWork(FPCGExContext* InContext, const UPCGExSettings* InSettings) const
 {
 	PCGEX_SETTINGS_C(InContext, AssetCollectionToSet)
@@ -73,7 +85,6 @@ bool FPCGExAssetCollectionToSetElement::AdvanceWork(FPCGExContext* InContext, co
 		return InContext->TryComplete();
 	};
 
-	PCGExHelpers::LoadBlocking_AnyThread(Settings->AssetCollection.ToSoftObjectPath(), InContext);
 	UPCGExAssetCollection* MainCollection = Settings->AssetCollection.Get();
 
 	if (!MainCollection)
@@ -84,6 +84,11 @@ void FPCGExAssetStagingContext::RegisterAssetDependencies()
 	{
 		MainCollection->GetAssetPaths(GetRequiredAssets(), PCGExAssetCollection::ELoadingFlags::Recursive);
 	}
+	else if (Settings->CollectionSource == EPCGExCollectionSource::Asset && !MainCollection)
+	{
+		// Collection isn't in memory yet; stream it with the other dependencies rather than blocking in Boot
+		AddAssetDependency(Settings->AssetCollection.ToSoftObjectPath());
+	}
 }
 
 #pragma endregion
@@ -109,15 +114,14 @@ bool FPCGExAssetStagingElement::Boot(FPCGExContext* InContext) const
 
 	if (Settings->CollectionSource == EPCGExCollectionSource::Asset)
 	{
-		PCGExHelpers::LoadBlocking_AnyThreadTpl(Settings->AssetCollection, Context);
-		Context->MainCollection = Settings->AssetCollection.Get();
-		if (!Context->MainCollection)
+		if (Settings->AssetCollection.IsNull())
 		{
 			PCGE_LOG(Error, GraphAndLog, FTEXT("Missing asset collection."));
 			return false;
 		}
 
-		Context->MainCollection->EDITOR_RegisterTrackingKeys(Context);
+		// May still be null here, in which case it is resolved in PostLoadAssetsDependencies
+		Context->MainCollection = Settings->AssetCollection.Get();
 	}
 	else if (Settings->CollectionSource == EPCGExCollectionSource::AttributeSet)
 	{
@@ -145,12 +149,6 @@ bool FPCGExAssetStagingElement::Boot(FPCGExContext* InContext) const
 		Context->CollectionsLoader = MakeShared<PCGEx::TAssetLoader<UPCGExAssetCollection>>(Context, Context->MainPoints.ToSharedRef(), Names);
 	}
 
-	if (Context->bPickMaterials && Context->MainCollection && !Context->MainCollection->IsType(PCGExAssetCollection::TypeIds::Mesh))
-	{
-		Context->bPickMaterials = false;
-		PCGE_LOG(Warning, GraphAndLog, FTEXT("Pick Material is enabled, but the selected collection doesn't support material picking."));
-	}
-
 	PCGEX_VALIDATE_NAME(Settings->AssetPathAttributeName)
 
 	if (Settings->WeightToAttribute == EPCGExWeightOutputMode::Raw || Settings->WeightToAttribute == EPCGExWeightOutputMode::Normalized)
@@ -207,6 +205,17 @@ void FPCGExAssetStagingElement::PostLoadAssetsDependencies(FPCGExContext* InCont
 		// Now that PCG has loaded the assets, rebuild staging data (bounds, paths, etc.)
 		Context->MainCollection->RebuildStagingData(true);
 	}
+	else if (Settings->CollectionSource == EPCGExCollectionSource::Asset)
+	{
+		if (!Context->MainCollection) { Context->MainCollection = Settings->AssetCollection.Get(); }
+		if (Context->MainCollection) { Context->MainCollection->EDITOR_RegisterTrackingKeys(Context); }
+	}
+
+	if (Context->bPickMaterials && Context->MainCollection && !Context->MainCollection->IsType(PCGExAssetCollection::TypeIds::Mesh))
+	{
+		Context->bPickMaterials = false;
+		PCGE_LOG_C(Warning, GraphAndLog, Context, FTEXT("Pick Material is enabled, but the selected collection doesn't support material picking."));
+	}
 }
 
 bool FPCGExAssetStagingElement::PostBoot(FPCGExContext* InContext) const
@@ -216,7 +225,12 @@ bool FPCGExAssetStagingElement::PostBoot(FPCGExContext* InContext) const
 	// Skip validation for Attribute mode - collections load per-point in AdvanceWork
 	if (Settings->CollectionSource != EPCGExCollectionSource::Attribute)
 	{
-		check(Context->MainCollection)
+		if (!Context->MainCollection)
+		{
+			PCGE_LOG_C(Error, GraphAndLog, Context, FTEXT("Missing asset collection."));
+			return false;
+		}
+
 		if (Context->MainCollection->LoadCache()->IsEmpty())
 		{
 			if (!Settings->bQuietEmptyCollectionError)
@@ -49,11 +49,22 @@ bool FPCGExCollectionToModuleInfosElement::IsCacheable(const UPCGSettings* InSet
 	PCGEX_GET_OPTION_STATE(Settings->CacheData, bDefaultCacheNodeOutput)
 }
 
+bool FPCGExCollectionToModuleInfosElement::Boot(FPCGExContext* InContext) const
+{
+	if (!IPCGExElement::Boot(InContext)) { return false; }
+
+	PCGEX_SETTINGS_C(InContext, CollectionToModuleInfos)
+
+	// Let the collection stream in with the preparation phase rather than blocking in AdvanceWork
+	if (!Settings->AssetCollection.IsNull() && !Settings->AssetCollection.Get()) { InContext->AddAssetDependency(Settings->AssetCollection.ToSoftObjectPath()); }
+
+	return true;
+}
+
 bool FPCGExCollectionToModuleInfosElement::AdvanceWork(FPCGExContext* InContext, const UPCGExSettings* InSettings) const
 {
 	PCGEX_SETTINGS_C(InContext, CollectionToModuleInfos)
 
-	PCGExHelpers::LoadBlocking_AnyThreadTpl(Settings->AssetCollection, InContext);
 	UPCGExAssetCollection* MainCollection = Settings->AssetCollection.Get();
 
 	if (!MainCollection)
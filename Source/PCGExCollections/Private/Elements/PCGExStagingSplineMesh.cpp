@@ -102,13 +102,14 @@ bool FPCGExPathSplineMeshElement::Boot(FPCGExContext* InContext) const
 	{
 		if (Settings->CollectionSource == EPCGExCollectionSource::Asset)
 		{
-			PCGExHelpers::LoadBlocking_AnyThreadTpl(Settings->AssetCollection, Context);
-			Context->MainCollection = Settings->AssetCollection.Get();
-			if (!Context->MainCollection)
+			if (Settings->AssetCollection.IsNull())
 			{
 				PCGE_LOG(Error, GraphAndLog, FTEXT("Missing asset collection."));
 				return false;
 			}
+
+			// May still be null here, in which case it is streamed in as an asset dependency
+			Context->MainCollection = Settings->AssetCollection.Get();
 		}
 		else if (Settings->CollectionSource == EPCGExCollectionSource::AttributeSet)
 		{
@@ -145,7 +146,8 @@ void FPCGExPathSplineMeshContext::RegisterAssetDependencies()
 	PCGEX_SETTINGS_LOCAL(PathSplineMesh)
 	if (!Settings->bUseStagedPoints && Settings->CollectionSource != EPCGExCollectionSource::Attribute)
 	{
-		MainCollection->GetAssetPaths(GetRequiredAssets(), PCGExAssetCollection::ELoadingFlags::Recursive);
+		if (MainCollection) { MainCollection->GetAssetPaths(GetRequiredAssets(), PCGExAssetCollection::ELoadingFlags::Recursive); }
+		else { AddAssetDependency(Settings->AssetCollection.ToSoftObjectPath()); } // Content is gathered once the collection is in
 	}
 }
 
@@ -157,6 +159,31 @@ void FPCGExPathSplineMeshElement::PostLoadAssetsDependencies(FPCGExContext* InCo
 		// Internal collection, assets have been loaded at this point, rebuilding stage data
 		Context->MainCollection->RebuildStagingData(true);
 	}
+	else if (!Settings->bUseStagedPoints && Settings->CollectionSource == EPCGExCollectionSource::Asset && !Context->MainCollection)
+	{
+		// The collection was streamed in with the other dependencies; its content still needs to be,
+		// so hold preparation on one more batched request
+		Context->MainCollection = Settings->AssetCollection.Get();
+		if (Context->MainCollection)
+		{
+			Context->AssetPaths = MakeShared<TSet<FSoftObjectPath>>();
+			Context->MainCollection->GetAssetPaths(*Context->AssetPaths.Get(), PCGExAssetCollection::ELoadingFlags::Recursive);
+
+			if (!Context->AssetPaths->IsEmpty())
+			{
+				Context->SetState(PCGExCommon::States::State_AsyncPreparation);
+				PCGExHelpers::Load(
+					Context->GetTaskManager(),
+					[Paths = Context->AssetPaths]() { return Paths->Array(); },
+					[Ctx = Context->GetOrCreateHandle()](const bool bSuccess, TSharedPtr<FStreamableHandle> StreamableHandle)
+					{
+						PCGEX_SHARED_CONTEXT_VOID(Ctx)
+						SharedContext.Get()->TrackAssetsHandle(StreamableHandle);
+						if (!bSuccess) { SharedContext.Get()->CancelExecution("Could not load collection assets"); }
+					});
+			}
+		}
+	}
 
 	FPCGExPathProcessorElement::PostLoadAssetsDependencies(InContext);
 }
@@ -170,7 +197,12 @@ bool FPCGExPathSplineMeshElement::PostBoot(FPCGExContext* InContext) const
 	// No main collection
 	if (Settings->bUseStagedPoints || Settings->CollectionSource == EPCGExCollectionSource::Attribute) { return true; }
 
-	if (!Context->MainCollection) { return false; }
+	if (!Context->MainCollection)
+	{
+		PCGE_LOG_C(Error, GraphAndLog, Context, FTEXT("Missing asset collection."));
+		return false;
+	}
+
 	Context->MainCollection->LoadCache(); // Make sure to load the stuff
 	return true;
 }
@@ -585,11 +617,27 @@ namespace PCGExPathSplineMesh
 
 		PCGEX_MAKE_SHARED(MaterialPaths, TSet<FSoftObjectPath>)
 		ScopedMaterials->Collapse(*MaterialPaths.Get());
-		if (!MaterialPaths->IsEmpty()) { PCGExHelpers::LoadBlocking_AnyThread(MaterialPaths, Context); } // TODO : Refactor this atrocity
 
-		//
+		if (MaterialPaths->IsEmpty())
+		{
+			StartSpawningSegments();
+			return;
+		}
 
+		// Stream every picked material in one request and resume once they're in
+		PCGExHelpers::Load(
+			TaskManager,
+			[MaterialPaths]() { return MaterialPaths->Array(); },
+			[PCGEX_ASYNC_THIS_CAPTURE](const bool bSuccess, TSharedPtr<FStreamableHandle> StreamableHandle)
+			{
+				PCGEX_ASYNC_THIS
+				This->Context->TrackAssetsHandle(StreamableHandle);
+				This->StartSpawningSegments();
+			});
+	}
 
+	void FProcessor::StartSpawningSegments()
+	{
 		TargetActor = Settings->TargetActor.Get() ? Settings->TargetActor.Get() : ExecutionContext->GetTargetActor(nullptr);
 		ObjectFlags = (bIsPreviewMode ? RF_Transient : RF_NoFlags);
 
@@ -124,7 +124,10 @@ namespace PCGExCollections
 		// Apply distribution strategy (no category, or category resolved to a subcollection)
 		switch (Details.Distribution)
 		{
-		case EPCGExDistribution::WeightedRandom: return WorkingCollection->GetEntryWeightedRandom(Seed);
+		case EPCGExDistribution::WeightedRandom:
+			// Top-level picks reuse the cache loaded in Init rather than going through LoadCache() for every point
+			if (WorkingCollection == Collection) { return Collection->GetEntryWeightedRandom(Cache, Seed); }
+			return WorkingCollection->GetEntryWeightedRandom(Seed);
 
 		case EPCGExDistribution::Random: return WorkingCollection->GetEntryRandom(Seed);
 
@@ -221,7 +224,9 @@ namespace PCGExCollections
 		// Apply distribution strategy with tags
 		switch (Details.Distribution)
 		{
-		case EPCGExDistribution::WeightedRandom: return WorkingCollection->GetEntryWeightedRandom(Seed, TagInheritance, OutTags);
+		case EPCGExDistribution::WeightedRandom:
+			if (WorkingCollection == Collection) { return Collection->GetEntryWeightedRandom(Cache, Seed, TagInheritance, OutTags); }
+			return WorkingCollection->GetEntryWeightedRandom(Seed, TagInheritance, OutTags);
 
 		case EPCGExDistribution::Random: return WorkingCollection->GetEntryRandom(Seed, TagInheritance, OutTags);
 
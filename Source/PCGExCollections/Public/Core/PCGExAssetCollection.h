@@ -23,6 +23,11 @@ struct FAssetData;
 
 class UPCGExAssetCollection;
 
+namespace PCGExMT
+{
+	struct FScope;
+}
+
 namespace PCGExAssetCollection
 {
 	class FCache;
@@ -279,6 +284,7 @@ namespace PCGExAssetCollection
 		double WeightSum = 0;
 		TArray<int32> Weights;
 		TArray<int32> Order;
+		TArray<int32> Guide;
 
 	public:
 		FMicroCache() = default;
@@ -316,6 +322,7 @@ namespace PCGExAssetCollection
 		TArray<int32> Indices;
 		TArray<int32> Weights;
 		TArray<int32> Order;
+		TArray<int32> Guide;
 		TArray<const FPCGExAssetCollectionEntry*> Entries;
 
 		FCategory() = default;
@@ -454,12 +461,16 @@ public:
 	/** Get random entry (weighted by entry Weight property) */
 	FPCGExEntryAccessResult GetEntryWeightedRandom(int32 Seed) const;
 
+	/** Same as GetEntryWeightedRandom(Seed), picking from an already loaded cache of this collection */
+	FPCGExEntryAccessResult GetEntryWeightedRandom(const PCGExAssetCollection::FCache* InCache, int32 Seed) const;
+
 	// With tag inheritance
 	FPCGExEntryAccessResult GetEntryAt(int32 Index, uint8 TagInheritance, TSet<FName>& OutTags) const;
 	FPCGExEntryAccessResult GetEntryRaw(int32 RawIndex, uint8 TagInheritance, TSet<FName>& OutTags) const;
 	FPCGExEntryAccessResult GetEntry(int32 Index, int32 Seed, EPCGExIndexPickMode PickMode, uint8 TagInheritance, TSet<FName>& OutTags) const;
 	FPCGExEntryAccessResult GetEntryRandom(int32 Seed, uint8 TagInheritance, TSet<FName>& OutTags) const;
 	FPCGExEntryAccessResult GetEntryWeightedRandom(int32 Seed, uint8 TagInheritance, TSet<FName>& OutTags) const;
+	FPCGExEntryAccessResult GetEntryWeightedRandom(const PCGExAssetCollection::FCache* InCache, int32 Seed, uint8 TagInheritance, TSet<FName>& OutTags) const;
 
 #pragma endregion
 
@@ -137,6 +137,7 @@ public:
 protected:
 	PCGEX_ELEMENT_CREATE_DEFAULT_CONTEXT
 
+	virtual bool Boot(FPCGExContext* InContext) const override;
 	virtual bool AdvanceWork(FPCGExContext* InContext, const UPCGExSettings* InSettings) const override;
 	static void ProcessEntry(
 		FPCGExContext* InContext,
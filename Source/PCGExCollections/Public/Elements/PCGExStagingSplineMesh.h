@@ -292,6 +292,7 @@ namespace PCGExPathSplineMesh
 		virtual void ProcessPoints(const PCGExMT::FScope& Scope) override;
 
 		virtual void OnPointsProcessingComplete() override;
+		void StartSpawningSegments();
 		void ProcessSegment(const int32 Index);
 
 		virtual void CompleteWork() override;
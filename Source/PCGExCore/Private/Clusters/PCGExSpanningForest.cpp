@@ -0,0 +1,150 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Clusters/PCGExSpanningForest.h"
+
+#include "PCGExH.h"
+#include "Async/ParallelFor.h"
+#include "Clusters/PCGExCluster.h"
+
+namespace PCGExClusters::SpanningForest
+{
+	FConcurrentUnionFind::FConcurrentUnionFind(const int32 InNum)
+	{
+		Parent.SetNumUninitialized(InNum);
+		for (int32 i = 0; i < InNum; i++) { Parent[i] = i; }
+	}
+
+	int32 FConcurrentUnionFind::Find(int32 Index)
+	{
+		while (true)
+		{
+			const int32 P = FPlatformAtomics::AtomicRead_Relaxed(&Parent[Index]);
+			if (P == Index) { return Index; }
+
+			const int32 GP = FPlatformAtomics::AtomicRead_Relaxed(&Parent[P]);
+			if (GP != P) { FPlatformAtomics::InterlockedCompareExchange(&Parent[Index], GP, P); }
+
+			Index = GP;
+		}
+	}
+
+	bool FConcurrentUnionFind::Unite(int32 A, int32 B)
+	{
+		while (true)
+		{
+			A = Find(A);
+			B = Find(B);
+
+			if (A == B) { return false; }
+			if (A > B) { Swap(A, B); }
+
+			// B is only linked if it is still a root; otherwise retry from the new roots
+			if (FPlatformAtomics::InterlockedCompareExchange(&Parent[B], A, B) == B) { return true; }
+		}
+	}
+
+	int32 Boruvka(const int32 NumNodes, const TArray<uint64>& Endpoints, const TArray<double>& Weights, TArray<int8>& OutInForest)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExClusters::SpanningForest::Boruvka);
+
+		const int32 NumEdges = Endpoints.Num();
+		check(Weights.Num() == NumEdges)
+
+		OutInForest.Init(0, NumEdges);
+		if (!NumEdges || NumNodes < 2) { return 0; }
+
+		auto IsLighter = [&](const int32 E, const int32 Other)
+		{
+			return Weights[E] < Weights[Other] || (Weights[E] == Weights[Other] && E < Other);
+		};
+
+		FConcurrentUnionFind Components(NumNodes);
+
+		TArray<int32> Cheapest;
+		Cheapest.Init(-1, NumNodes);
+
+		TArray<int32> Active;
+		Active.Reserve(NumEdges);
+		for (int32 i = 0; i < NumEdges; i++) { if (PCGEx::H64A(Endpoints[i]) != PCGEx::H64B(Endpoints[i])) { Active.Add(i); } }
+
+		TArray<int8> Alive;
+		TArray<int32> Roots;
+
+		int32 NumForestEdges = 0;
+
+		while (!Active.IsEmpty())
+		{
+			const int32 NumActive = Active.Num();
+			const bool bInline = NumActive < 1024;
+
+			Alive.SetNumUninitialized(NumActive);
+
+			// Each component keeps the lightest edge leaving it
+			ParallelFor(
+				NumActive, [&](const int32 i)
+				{
+					const int32 E = Active[i];
+					const int32 RootA = Components.Find(static_cast<int32>(PCGEx::H64A(Endpoints[E])));
+					const int32 RootB = Components.Find(static_cast<int32>(PCGEx::H64B(Endpoints[E])));
+
+					Alive[i] = RootA != RootB;
+					if (!Alive[i]) { return; }
+
+					for (const int32 Root : {RootA, RootB})
+					{
+						int32 Current = FPlatformAtomics::AtomicRead_Relaxed(&Cheapest[Root]);
+						while (Current == -1 || IsLighter(E, Current))
+						{
+							const int32 Previous = FPlatformAtomics::InterlockedCompareExchange(&Cheapest[Root], E, Current);
+							if (Previous == Current) { break; }
+							Current = Previous;
+						}
+					}
+				}, bInline);
+
+			int32 WriteIndex = 0;
+			for (int32 i = 0; i < NumActive; i++) { if (Alive[i]) { Active[WriteIndex++] = Active[i]; } }
+			Active.SetNum(WriteIndex, EAllowShrinking::No);
+
+			if (Active.IsEmpty()) { break; }
+
+			Roots.Reset();
+			for (int32 i = 0; i < NumNodes; i++) { if (Cheapest[i] != -1) { Roots.Add(i); } }
+
+			// Cheapest edges are all in the forest; two components picking the same edge only merge once
+			int32 NumMerged = 0;
+			ParallelFor(
+				Roots.Num(), [&](const int32 i)
+				{
+					const int32 E = Cheapest[Roots[i]];
+					if (!Components.Unite(static_cast<int32>(PCGEx::H64A(Endpoints[E])), static_cast<int32>(PCGEx::H64B(Endpoints[E])))) { return; }
+
+					OutInForest[E] = 1;
+					FPlatformAtomics::InterlockedIncrement(&NumMerged);
+				}, Roots.Num() < 1024);
+
+			for (const int32 Root : Roots) { Cheapest[Root] = -1; }
+
+			NumForestEdges += NumMerged;
+		}
+
+		return NumForestEdges;
+	}
+
+	int32 Boruvka(const FCluster* InCluster, const TArray<double>& Weights, TArray<int8>& OutInForest)
+	{
+		const int32 NumEdges = InCluster->Edges->Num();
+
+		TArray<uint64> Endpoints;
+		Endpoints.SetNumUninitialized(NumEdges);
+
+		ParallelFor(
+			NumEdges, [&](const int32 i)
+			{
+				Endpoints[i] = PCGEx::H64(InCluster->GetEdgeStart(i)->Index, InCluster->GetEdgeEnd(i)->Index);
+			}, NumEdges < 1024);
+
+		return Boruvka(InCluster->Nodes->Num(), Endpoints, Weights, OutInForest);
+	}
+}
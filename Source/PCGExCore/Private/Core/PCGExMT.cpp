@@ -49,6 +49,58 @@ namespace PCGExMT
 		return OutSubRanges.Num();
 	}
 
+	int32 CoalesceWorkUnits(const TArray<int32>& InCosts, const int32 InSmallCost, TArray<int32>& OutOrder, TArray<FScope>& OutUnits)
+	{
+		// Flat per-item cost standing in for the orchestration every item pays regardless of its size
+		constexpr int64 ItemOverhead = 64;
+
+		const int32 NumItems = InCosts.Num();
+
+		OutOrder.Reset(NumItems);
+		OutUnits.Reset();
+
+		// Large items first, one unit each; they are the long poles and benefit from starting early
+		int64 SmallCost = 0;
+		for (int32 i = 0; i < NumItems; i++)
+		{
+			if (InCosts[i] >= InSmallCost)
+			{
+				OutUnits.Emplace(OutOrder.Num(), 1, OutUnits.Num());
+				OutOrder.Add(i);
+			}
+			else
+			{
+				SmallCost += InCosts[i] + ItemOverhead;
+			}
+		}
+
+		if (OutOrder.Num() == NumItems) { return OutUnits.Num(); }
+
+		// A few units per core, but never less than a small item's worth of work per unit
+		const int64 TargetCost = FMath::Max<int64>(InSmallCost, FMath::DivideAndRoundUp<int64>(SmallCost, FPlatformMisc::NumberOfCores() * 4));
+
+		int32 UnitStart = OutOrder.Num();
+		int64 UnitCost = 0;
+
+		for (int32 i = 0; i < NumItems; i++)
+		{
+			if (InCosts[i] >= InSmallCost) { continue; }
+
+			OutOrder.Add(i);
+			UnitCost += InCosts[i] + ItemOverhead;
+
+			if (UnitCost < TargetCost) { continue; }
+
+			OutUnits.Emplace(UnitStart, OutOrder.Num() - UnitStart, OutUnits.Num());
+			UnitStart = OutOrder.Num();
+			UnitCost = 0;
+		}
+
+		if (UnitStart < OutOrder.Num()) { OutUnits.Emplace(UnitStart, OutOrder.Num() - UnitStart, OutUnits.Num()); }
+
+		return OutUnits.Num();
+	}
+
 	// IAsyncHandle
 	IAsyncHandle::~IAsyncHandle()
 	{
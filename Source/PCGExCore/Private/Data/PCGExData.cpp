@@ -13,6 +13,7 @@
 #include "Data/PCGExDataTags.h"
 #include "Data/PCGExPointIO.h"
 #include "Data/PCGPointData.h"
+#include "Data/Utils/PCGExAttributeColumnCache.h"
 #include "Helpers/PCGExArrayHelpers.h"
 #include "Metadata/Accessors/PCGAttributeAccessorHelpers.h"
 #include "Metadata/Accessors/PCGCustomAccessor.h"
@@ -294,6 +295,28 @@ template PCGEXCORE_API bool IBuffer::IsA<_TYPE>() const;
 			return false;
 		}
 
+		// Full reads of input data are shared process-wide, so nodes chained on the same data only decode it once.
+		// Cached columns are never written to: input-side values are read-only and scoped buffers are not cached.
+		// Forwarded inputs are written to in place, so they are neither cached nor served from the cache.
+		FAttributeColumnCache& ColumnCache = FAttributeColumnCache::Get();
+		const int32 NumReadValue = Source->GetIn()->GetNumPoints();
+		const bool bUseColumnCache = !bScoped && Source->GetOut() != Source->GetIn() && ColumnCache.CanCache(NumReadValue);
+		const FAttributeColumnKey ColumnKey = bUseColumnCache ? FAttributeColumnKey(Source->GetIn(), TypedInAttribute, this->UID, NumReadValue) : FAttributeColumnKey();
+
+		if (bUseColumnCache)
+		{
+			if (TSharedPtr<TArray<T>> CachedValues = ColumnCache.Find<T>(ColumnKey))
+			{
+				InValues = CachedValues;
+				if (bCacheValueHashes) { InHashes.Init(0, NumReadValue); }
+
+				InAttribute = TypedInAttribute;
+				bSparseBuffer = false;
+				bReadComplete = true;
+				return true;
+			}
+		}
+
 		InitForReadInternal(bScoped, TypedInAttribute);
 
 		// Non-scoped buffers bulk-read all values upfront. Scoped buffers leave
@@ -303,6 +326,8 @@ template PCGEXCORE_API bool IBuffer::IsA<_TYPE>() const;
 			TArrayView<T> InRange = MakeArrayView(InValues->GetData(), InValues->Num());
 			InAccessor->GetRange<T>(InRange, 0, *Source->GetInKeys());
 			bReadComplete = true;
+
+			if (bUseColumnCache) { ColumnCache.Add<T>(ColumnKey, InValues); }
 		}
 
 		return true;
@@ -438,6 +463,9 @@ template PCGEXCORE_API bool IBuffer::IsA<_TYPE>() const;
 
 		if (!TypedOutAttribute) { return; }
 
+		// Output may be the forwarded input; drop any column decoded from it before it changes
+		FAttributeColumnCache::Get().Invalidate(Source->GetOut());
+
 		// bResetWithFirstValue: collapse the entire attribute to a single default value.
 		// Used for @Data-domain attributes that should carry one value for the whole dataset.
 		if (this->bResetWithFirstValue)
@@ -458,6 +486,31 @@ template PCGEXCORE_API bool IBuffer::IsA<_TYPE>() const;
 		OutAccessor->SetRange<T>(View, 0, *Source->GetOutKeys(bEnsureValidKeys).Get());
 	}
 
+	template <typename T>
+	bool TArrayBuffer<T>::BeginRangeWrite()
+	{
+		PCGEX_SHARED_CONTEXT_RET(Source->GetContextHandle(), false)
+
+		if (!IsWritable() || !OutValues || !IsEnabled() || this->bResetWithFirstValue) { return false; }
+		if (!Source->GetOut() || !TypedOutAttribute) { return false; }
+
+		FAttributeColumnCache::Get().Invalidate(Source->GetOut());
+		SharedContext.Get()->AddProtectedAttributeName(TypedOutAttribute->Name);
+		return true;
+	}
+
+	template <typename T>
+	void TArrayBuffer<T>::WriteRange(const PCGExMT::FScope& Scope)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(TBuffer::WriteRange);
+
+		TUniquePtr<IPCGAttributeAccessor> OutAccessor = PCGAttributeAccessorHelpers::CreateAccessor(TypedOutAttribute, Source->GetOut()->Metadata);
+		if (!OutAccessor.IsValid()) { return; }
+
+		TArrayView<const T> View = MakeArrayView(OutValues->GetData() + Scope.Start, Scope.Count);
+		OutAccessor->SetRange<T>(View, Scope.Start, *Source->GetOutKeys(false).Get());
+	}
+
 	template <typename T>
 	void TArrayBuffer<T>::Fetch(const PCGExMT::FScope& Scope)
 	{
@@ -684,6 +737,7 @@ template PCGEXCORE_API bool IBuffer::IsA<_TYPE>() const;
 
 		if (!TypedOutAttribute) { return; }
 
+		FAttributeColumnCache::Get().Invalidate(Source->GetOut());
 		Helpers::SetDataValue(TypedOutAttribute, OutValue);
 	}
 
@@ -1030,25 +1084,127 @@ template PCGEXCORE_API const FPCGMetadataAttribute<_TYPE>* FFacade::FindConstAtt
 		BufferMap.Empty();
 	}
 
+	namespace
+	{
+		// Below this, splitting a buffer costs more in accessor setup than it saves
+		constexpr int32 MinRangeWriteSize = 32768;
+
+		/** Either a batch of whole buffers written one after the other, or a single range of a large buffer. */
+		struct FBufferWriteJob
+		{
+			TArray<TSharedPtr<IBuffer>, TInlineAllocator<4>> Buffers;
+			TSharedPtr<IBuffer> RangeBuffer;
+			PCGExMT::FScope Scope;
+			int64 NumValues = 0;
+
+			void Execute() const
+			{
+				if (RangeBuffer)
+				{
+					RangeBuffer->WriteRange(Scope);
+					return;
+				}
+
+				for (const TSharedPtr<IBuffer>& Buffer : Buffers) { Buffer->Write(false); }
+			}
+		};
+
+		class FWriteBufferJobTask final : public PCGExMT::FTask
+		{
+		public:
+			PCGEX_ASYNC_TASK_NAME(FWriteJobTask)
+
+			explicit FWriteBufferJobTask(FBufferWriteJob&& InJob)
+				: FTask(), Job(MoveTemp(InJob))
+			{
+			}
+
+			FBufferWriteJob Job;
+
+			virtual void ExecuteTask(const TSharedPtr<PCGExMT::FTaskManager>& TaskManager) override
+			{
+				Job.Execute();
+			}
+		};
+
+		/**
+		 * Turns writable buffers into jobs of comparable size.
+		 * The target size is the total amount of values to write spread over about two jobs per core, with a floor.
+		 * Element buffers above it are cut into ranges, so a single huge attribute spreads over every core;
+		 * smaller buffers are packed together, largest first, so the longest writes start early and tiny ones share a task.
+		 * Ranges are only allowed once output keys have been made valid, since they only read them.
+		 */
+		void GatherWriteJobs(const TArray<TSharedPtr<IBuffer>>& InBuffers, const bool bAllowRanges, TArray<FBufferWriteJob>& OutJobs)
+		{
+			TArray<TPair<int64, TSharedPtr<IBuffer>>> SizedBuffers;
+			SizedBuffers.Reserve(InBuffers.Num());
+
+			int64 TotalValues = 0;
+			for (const TSharedPtr<IBuffer>& Buffer : InBuffers)
+			{
+				if (!Buffer.IsValid() || !Buffer->IsWritable() || !Buffer->IsEnabled()) { continue; }
+
+				const bool bSingleValue = Buffer->GetUnderlyingDomain() == EDomainType::Data || Buffer->bResetWithFirstValue;
+				const int64 NumValues = bSingleValue ? 1 : FMath::Max(1, Buffer->GetNumValues(EIOSide::Out));
+
+				SizedBuffers.Emplace(NumValues, Buffer);
+				TotalValues += NumValues;
+			}
+
+			// Stable on ties so the job layout doesn't depend on sort internals
+			SizedBuffers.StableSort([](const TPair<int64, TSharedPtr<IBuffer>>& A, const TPair<int64, TSharedPtr<IBuffer>>& B) { return A.Key > B.Key; });
+
+			const int64 JobSize = FMath::Max<int64>(MinRangeWriteSize, FMath::DivideAndRoundUp<int64>(TotalValues, FPlatformMisc::NumberOfCores() * 2));
+
+			OutJobs.Reserve(SizedBuffers.Num());
+
+			FBufferWriteJob Batch;
+			for (const TPair<int64, TSharedPtr<IBuffer>>& Sized : SizedBuffers)
+			{
+				const TSharedPtr<IBuffer>& Buffer = Sized.Value;
+
+				if (bAllowRanges && Sized.Key > JobSize && Buffer->BeginRangeWrite())
+				{
+					const int32 NumValues = static_cast<int32>(Sized.Key);
+					const int32 RangeSize = static_cast<int32>(JobSize);
+					for (int32 Start = 0; Start < NumValues; Start += RangeSize)
+					{
+						FBufferWriteJob& Job = OutJobs.Emplace_GetRef();
+						Job.RangeBuffer = Buffer;
+						Job.Scope = PCGExMT::FScope(Start, FMath::Min(RangeSize, NumValues - Start));
+						Job.NumValues = Job.Scope.Count;
+					}
+					continue;
+				}
+
+				if (!Batch.Buffers.IsEmpty() && Batch.NumValues + Sized.Key > JobSize) { OutJobs.Add(MoveTemp(Batch)); Batch = FBufferWriteJob(); }
+
+				Batch.Buffers.Add(Buffer);
+				Batch.NumValues += Sized.Key;
+			}
+
+			if (!Batch.Buffers.IsEmpty()) { OutJobs.Add(MoveTemp(Batch)); }
+		}
+	}
+
 	void FFacade::Write(const TSharedPtr<PCGExMT::FTaskManager>& TaskManager, const bool bEnsureValidKeys)
 	{
 		if (!TaskManager || !TaskManager->IsAvailable() || !Source->GetOut()) { return; }
 
 		if (ValidateOutputsBeforeWriting())
 		{
-			if (bEnsureValidKeys) { Source->GetOutKeys(true); }
+			// Resolve output keys once, before any job reads them
+			Source->GetOutKeys(bEnsureValidKeys);
+
+			TArray<FBufferWriteJob> Jobs;
 
 			{
 				FWriteScopeLock WriteScopeLock(BufferLock);
-				PCGEX_ASYNC_SCHEDULING_SCOPE(TaskManager)
-
-				for (int i = 0; i < Buffers.Num(); i++)
-				{
-					const TSharedPtr<IBuffer> Buffer = Buffers[i];
-					if (!Buffer.IsValid() || !Buffer->IsWritable() || !Buffer->IsEnabled()) { continue; }
-					WriteBuffer(TaskManager, Buffer, false);
-				}
+				GatherWriteJobs(Buffers, bEnsureValidKeys, Jobs);
 			}
+
+			PCGEX_ASYNC_SCHEDULING_SCOPE(TaskManager)
+			for (FBufferWriteJob& Job : Jobs) { PCGEX_LAUNCH(FWriteBufferJobTask, MoveTemp(Job)) }
 		}
 
 		Flush();
@@ -1064,23 +1220,19 @@ template PCGEXCORE_API const FPCGMetadataAttribute<_TYPE>* FFacade::FindConstAtt
 			return -1;
 		}
 
-		int32 WritableCount = 0;
+		// Resolve output keys once, before any job reads them
 		Source->GetOutKeys(true);
 
+		TArray<FBufferWriteJob> Jobs;
+
 		{
 			FWriteScopeLock WriteScopeLock(BufferLock);
-
-			for (int i = 0; i < Buffers.Num(); i++)
-			{
-				const TSharedPtr<IBuffer> Buffer = Buffers[i];
-				if (!Buffer.IsValid() || !Buffer->IsWritable() || !Buffer->IsEnabled()) { continue; }
-
-				TaskGroup->AddSimpleCallback([BufferRef = Buffer]() { BufferRef->Write(); });
-				WritableCount++;
-			}
+			GatherWriteJobs(Buffers, true, Jobs);
 		}
 
-		return WritableCount;
+		for (FBufferWriteJob& Job : Jobs) { TaskGroup->AddSimpleCallback([Job = MoveTemp(Job)]() { Job.Execute(); }); }
+
+		return Jobs.Num();
 	}
 
 	void FFacade::WriteBuffers(const TSharedPtr<PCGExMT::FTaskManager>& TaskManager, PCGExMT::FCompletionCallback&& Callback)
@@ -1318,7 +1470,12 @@ template PCGEXCORE_API bool TryReadMark<_TYPE>(const TSharedRef<FPointIO>& Point
 		}
 		else
 		{
-			if (!TaskManager || !TaskManager->IsAvailable()) { InBuffer->Write(InEnsureValidKeys); }
+			if (!TaskManager || !TaskManager->IsAvailable())
+			{
+				InBuffer->Write(InEnsureValidKeys);
+				return;
+			}
+
 			PCGEX_LAUNCH(FWriteBufferTask, InBuffer, InEnsureValidKeys)
 		}
 	}
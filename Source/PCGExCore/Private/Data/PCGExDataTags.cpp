@@ -3,8 +3,222 @@
 
 #include "Data/PCGExDataTags.h"
 
+#include "Containers/ChunkedArray.h"
+
 namespace PCGExData
 {
+	namespace
+	{
+		// FString hashing and equality ignore case; exact spellings need their own lookup
+		struct FCaseSensitiveTagKeyFuncs : BaseKeyFuncs<TPair<FString, uint32>, FString, false>
+		{
+			static FORCEINLINE const FString& GetSetKey(const TPair<FString, uint32>& Element) { return Element.Key; }
+			static FORCEINLINE bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+			static FORCEINLINE uint32 GetKeyHash(const FString& Key) { return FCrc::StrCrc32(*Key); }
+		};
+
+		struct FTagTableStorage
+		{
+			FRWLock Lock;
+			TChunkedArray<FString> Strings; // Chunks never move, so references handed out survive growth
+			TArray<uint32> Keys;            // Per index, the index of the first spelling that compares equal
+			TMap<FString, uint32, FDefaultSetAllocator, FCaseSensitiveTagKeyFuncs> ExactIndices;
+			TMap<FString, uint32> FoldedKeys;
+
+			static FTagTableStorage& Get()
+			{
+				static FTagTableStorage Storage;
+				return Storage;
+			}
+		};
+
+		const FString EmptyTagString = TEXT("");
+	}
+
+#pragma region FTagTable
+
+	FTagId FTagTable::Intern(const FString& InString)
+	{
+		FTagTableStorage& Table = FTagTableStorage::Get();
+
+		{
+			FReadScopeLock ReadScopeLock(Table.Lock);
+			if (const uint32* Index = Table.ExactIndices.Find(InString)) { return FTagId(*Index, Table.Keys[*Index]); }
+		}
+
+		FWriteScopeLock WriteScopeLock(Table.Lock);
+		if (const uint32* Index = Table.ExactIndices.Find(InString)) { return FTagId(*Index, Table.Keys[*Index]); }
+
+		const uint32 Index = Table.Strings.AddElement(InString);
+		const uint32 Key = Table.FoldedKeys.FindOrAdd(InString, Index);
+
+		Table.Keys.Add(Key);
+		Table.ExactIndices.Add(InString, Index);
+
+		return FTagId(Index, Key);
+	}
+
+	FTagId FTagTable::Find(const FString& InString)
+	{
+		FTagTableStorage& Table = FTagTableStorage::Get();
+		FReadScopeLock ReadScopeLock(Table.Lock);
+
+		if (const uint32* Index = Table.ExactIndices.Find(InString)) { return FTagId(*Index, Table.Keys[*Index]); }
+		if (const uint32* Key = Table.FoldedKeys.Find(InString)) { return FTagId(*Key, *Key); }
+
+		return FTagId();
+	}
+
+	const FString& FTagTable::ToString(const FTagId& InId)
+	{
+		if (!InId.IsValid()) { return EmptyTagString; }
+
+		FTagTableStorage& Table = FTagTableStorage::Get();
+		FReadScopeLock ReadScopeLock(Table.Lock);
+		return Table.Strings[InId.Index];
+	}
+
+#pragma endregion
+
+#pragma region FTagValue
+
+	bool FTagValue::IsNumeric() const
+	{
+		switch (Type)
+		{
+		case EPCGMetadataTypes::Boolean:
+		case EPCGMetadataTypes::Integer32:
+		case EPCGMetadataTypes::Integer64:
+		case EPCGMetadataTypes::Float:
+		case EPCGMetadataTypes::Double:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	bool FTagValue::IsText() const
+	{
+		switch (Type)
+		{
+		case EPCGMetadataTypes::String:
+		case EPCGMetadataTypes::Name:
+		case EPCGMetadataTypes::SoftObjectPath:
+		case EPCGMetadataTypes::SoftClassPath:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	double FTagValue::AsDouble() const
+	{
+		switch (Type)
+		{
+		case EPCGMetadataTypes::Boolean:
+			return Integer ? 1 : 0;
+		case EPCGMetadataTypes::Integer32:
+		case EPCGMetadataTypes::Integer64:
+			return static_cast<double>(Integer);
+		case EPCGMetadataTypes::Float:
+		case EPCGMetadataTypes::Double:
+		case EPCGMetadataTypes::Vector2:
+		case EPCGMetadataTypes::Vector:
+		case EPCGMetadataTypes::Vector4:
+			return Real[0];
+		default:
+			return 0;
+		}
+	}
+
+	FString FTagValue::AsString() const
+	{
+		switch (Type)
+		{
+		case EPCGMetadataTypes::Boolean:
+			return Integer ? TEXT("true") : TEXT("false");
+		case EPCGMetadataTypes::Integer32:
+		case EPCGMetadataTypes::Integer64:
+			return FString::Printf(TEXT("%lld"), Integer);
+		case EPCGMetadataTypes::Float:
+		case EPCGMetadataTypes::Double:
+			return FString::Printf(TEXT("%.2f"), Real[0]);
+		case EPCGMetadataTypes::Vector2:
+			return Get<FVector2D>().ToString();
+		case EPCGMetadataTypes::Vector:
+			return Get<FVector>().ToString();
+		case EPCGMetadataTypes::Vector4:
+			return Get<FVector4>().ToString();
+		case EPCGMetadataTypes::String:
+		case EPCGMetadataTypes::Name:
+		case EPCGMetadataTypes::SoftObjectPath:
+		case EPCGMetadataTypes::SoftClassPath:
+			return FTagTable::ToString(Text);
+		default:
+			return TEXT("");
+		}
+	}
+
+	bool FTagValue::SameValue(const FTagValue& Other) const
+	{
+		if (IsNumeric() && Other.IsNumeric()) { return AsDouble() == Other.AsDouble(); }
+		if (IsText() && Other.IsText()) { return Text == Other.Text; }
+		return false;
+	}
+
+	FString FTagValue::Flatten(const FString& LeftSide) const
+	{
+		switch (Type)
+		{
+		case EPCGMetadataTypes::Integer32:
+		case EPCGMetadataTypes::Integer64:
+		case EPCGMetadataTypes::Float:
+		case EPCGMetadataTypes::Double:
+		case EPCGMetadataTypes::Vector2:
+		case EPCGMetadataTypes::Vector:
+		case EPCGMetadataTypes::Vector4:
+		case EPCGMetadataTypes::String:
+			return FString::Printf(TEXT("%s:%s"), *LeftSide, *AsString());
+		default:
+			return LeftSide;
+		}
+	}
+
+	TSharedPtr<IDataValue> FTagValue::ToDataValue() const
+	{
+		switch (Type)
+		{
+#define PCGEX_TPL(_TYPE, _NAME, ...) case EPCGMetadataTypes::_NAME: return MakeShared<TDataValue<_TYPE>>(Get<_TYPE>());
+		PCGEX_FOREACH_SUPPORTEDTYPES(PCGEX_TPL)
+#undef PCGEX_TPL
+		default:
+			return nullptr;
+		}
+	}
+
+	FTagValue FTagValue::Parse(const FString& InValue)
+	{
+		if (InValue.IsNumeric())
+		{
+			int32 FloatingPointPosition = INDEX_NONE;
+			if (InValue.FindChar('.', FloatingPointPosition)) { return Make<double>(FCString::Atod(*InValue)); }
+			return Make<int64>(FCString::Atoi64(*InValue));
+		}
+
+		if (FVector ParsedVector; ParsedVector.InitFromString(InValue)) { return Make<FVector>(ParsedVector); }
+		if (FVector2D ParsedVector2D; ParsedVector2D.InitFromString(InValue)) { return Make<FVector2D>(ParsedVector2D); }
+		if (FVector4 ParsedVector4; ParsedVector4.InitFromString(InValue)) { return Make<FVector4>(ParsedVector4); }
+
+		if (InValue.Equals(TEXT("TRUE"), ESearchCase::IgnoreCase)) { return Make<bool>(true); }
+		if (InValue.Equals(TEXT("FALSE"), ESearchCase::IgnoreCase)) { return Make<bool>(false); }
+
+		return Make<FString>(InValue);
+	}
+
+#pragma endregion
+
+#pragma region FTags
+
 	int32 FTags::Num() const
 	{
 		return RawTags.Num() + ValueTags.Num();
@@ -17,13 +231,12 @@ namespace PCGExData
 
 	FTags::FTags()
 	{
-		RawTags.Empty();
-		ValueTags.Empty();
 	}
 
 	FTags::FTags(const TSet<FString>& InTags)
 		: FTags()
 	{
+		RawTags.Reserve(InTags.Num());
 		for (const FString& TagString : InTags) { ParseAndAdd(TagString); }
 	}
 
@@ -35,18 +248,44 @@ namespace PCGExData
 
 	void FTags::Append(const TSharedRef<FTags>& InTags)
 	{
-		Append(InTags->FlattenToArray());
+		if (&InTags.Get() == this) { return; }
+
+		// Copy under the source lock only, so two tags appending into each other can't deadlock.
+		// Interned handles and inline values make this a flat copy.
+		TArray<FTagId, TInlineAllocator<8>> SourceRawTags;
+		TArray<FValueTag, TInlineAllocator<2>> SourceValueTags;
+
+		{
+			FReadScopeLock ReadScopeLock(InTags->TagsLock);
+			SourceRawTags = InTags->RawTags;
+			SourceValueTags = InTags->ValueTags;
+		}
+
+		FWriteScopeLock WriteScopeLock(TagsLock);
+
+		if (IsEmpty())
+		{
+			RawTags = MoveTemp(SourceRawTags);
+			ValueTags = MoveTemp(SourceValueTags);
+			return;
+		}
+
+		RawTags.Reserve(RawTags.Num() + SourceRawTags.Num());
+		for (const FTagId& Id : SourceRawTags) { AddRaw_Unsafe(Id); }
+		for (FValueTag& ValueTag : SourceValueTags) { SetValue_Unsafe(ValueTag.Key, MoveTemp(ValueTag.Value)); }
 	}
 
 	void FTags::Append(const TArray<FString>& InTags)
 	{
 		FWriteScopeLock WriteScopeLock(TagsLock);
+		RawTags.Reserve(RawTags.Num() + InTags.Num());
 		for (const FString& TagString : InTags) { ParseAndAdd(TagString); }
 	}
 
 	void FTags::Append(const TSet<FString>& InTags)
 	{
 		FWriteScopeLock WriteScopeLock(TagsLock);
+		RawTags.Reserve(RawTags.Num() + InTags.Num());
 		for (const FString& TagString : InTags) { ParseAndAdd(TagString); }
 	}
 
@@ -60,6 +299,8 @@ namespace PCGExData
 
 	void FTags::Reset(const TSharedPtr<FTags>& InTags)
 	{
+		if (InTags.Get() == this) { return; }
+
 		Reset();
 
 		if (InTags) { Append(InTags.ToSharedRef()); }
@@ -70,16 +311,15 @@ namespace PCGExData
 		FReadScopeLock ReadScopeLock(TagsLock);
 
 		InTags.Reserve(InTags.Num() + Num());
-		InTags.Append(RawTags);
 
-		if (bFlatten) { for (const TPair<FString, TSharedPtr<IDataValue>>& Pair : ValueTags) { InTags.Add(Pair.Value->Flatten(Pair.Key)); } }
-		else { for (const TPair<FString, TSharedPtr<IDataValue>>& Pair : ValueTags) { InTags.Add(Pair.Key); } }
+		for (const FTagId& Id : RawTags) { InTags.Add(FTagTable::ToString(Id)); }
+
+		if (bFlatten) { for (const FValueTag& ValueTag : ValueTags) { InTags.Add(ValueTag.Value.Flatten(FTagTable::ToString(ValueTag.Key))); } }
+		else { for (const FValueTag& ValueTag : ValueTags) { InTags.Add(FTagTable::ToString(ValueTag.Key)); } }
 	}
 
 	void FTags::DumpTo(TArray<FName>& InTags, const bool bFlatten) const
 	{
-		FReadScopeLock ReadScopeLock(TagsLock);
-		InTags.Reserve(Num());
 		InTags.Append(FlattenToArrayOfNames(bFlatten));
 	}
 
@@ -97,10 +337,10 @@ namespace PCGExData
 		TArray<FString> Flattened;
 		Flattened.Reserve(Num());
 
-		for (const FString& Key : RawTags) { Flattened.Add(Key); }
+		for (const FTagId& Id : RawTags) { Flattened.Add(FTagTable::ToString(Id)); }
 
-		if (bIncludeValue) { for (const TPair<FString, TSharedPtr<IDataValue>>& Pair : ValueTags) { Flattened.Add(Pair.Value->Flatten(Pair.Key)); } }
-		else { for (const TPair<FString, TSharedPtr<IDataValue>>& Pair : ValueTags) { Flattened.Add(Pair.Key); } }
+		if (bIncludeValue) { for (const FValueTag& ValueTag : ValueTags) { Flattened.Add(ValueTag.Value.Flatten(FTagTable::ToString(ValueTag.Key))); } }
+		else { for (const FValueTag& ValueTag : ValueTags) { Flattened.Add(FTagTable::ToString(ValueTag.Key)); } }
 
 		return Flattened;
 	}
@@ -112,10 +352,10 @@ namespace PCGExData
 		TArray<FName> Flattened;
 		Flattened.Reserve(Num());
 
-		for (const FString& Key : RawTags) { Flattened.Add(FName(Key)); }
+		for (const FTagId& Id : RawTags) { Flattened.Add(FName(FTagTable::ToString(Id))); }
 
-		if (bIncludeValue) { for (const TPair<FString, TSharedPtr<IDataValue>>& Pair : ValueTags) { Flattened.Add(FName(Pair.Value->Flatten(Pair.Key))); } }
-		else { for (const TPair<FString, TSharedPtr<IDataValue>>& Pair : ValueTags) { Flattened.Add(FName(Pair.Key)); } }
+		if (bIncludeValue) { for (const FValueTag& ValueTag : ValueTags) { Flattened.Add(FName(ValueTag.Value.Flatten(FTagTable::ToString(ValueTag.Key)))); } }
+		else { for (const FValueTag& ValueTag : ValueTags) { Flattened.Add(FName(FTagTable::ToString(ValueTag.Key))); } }
 
 		return Flattened;
 	}
@@ -128,62 +368,105 @@ namespace PCGExData
 
 	void FTags::Remove(const FString& Key)
 	{
+		const FTagId Id = FTagTable::Find(Key);
+		if (!Id.IsValid()) { return; }
+
 		FWriteScopeLock WriteScopeLock(TagsLock);
-		ValueTags.Remove(Key);
-		RawTags.Remove(Key);
+		Remove_Unsafe(Id);
 	}
 
 	void FTags::Remove(const TSet<FString>& InSet)
 	{
 		FWriteScopeLock WriteScopeLock(TagsLock);
-		for (const FString& Tag : InSet)
-		{
-			ValueTags.Remove(Tag);
-			RawTags.Remove(Tag);
-		}
+		for (const FString& Tag : InSet) { if (const FTagId Id = FTagTable::Find(Tag); Id.IsValid()) { Remove_Unsafe(Id); } }
 	}
 
 	void FTags::Remove(const TSet<FName>& InSet)
 	{
 		FWriteScopeLock WriteScopeLock(TagsLock);
-		for (const FName& Tag : InSet)
-		{
-			FString Key = Tag.ToString();
-			ValueTags.Remove(Key);
-			RawTags.Remove(Key);
-		}
+		for (const FName& Tag : InSet) { if (const FTagId Id = FTagTable::Find(Tag.ToString()); Id.IsValid()) { Remove_Unsafe(Id); } }
 	}
 
 	TSharedPtr<IDataValue> FTags::GetValue(const FString& Key) const
 	{
+		const FTagId Id = FTagTable::Find(Key);
+		if (!Id.IsValid()) { return nullptr; }
+
 		FReadScopeLock ReadScopeLock(TagsLock);
-		if (const TSharedPtr<IDataValue>* ValueTagPtr = ValueTags.Find(Key)) { return *ValueTagPtr; }
+		if (const FTagValue* Value = FindValue_Unsafe(Id)) { return Value->ToDataValue(); }
 		return nullptr;
 	}
 
 	bool FTags::IsTagged(const FString& Key) const
 	{
+		const FTagId Id = FTagTable::Find(Key);
+		if (!Id.IsValid()) { return false; }
+
 		FReadScopeLock ReadScopeLock(TagsLock);
-		return ValueTags.Contains(Key) || RawTags.Contains(Key);
+		return FindValue_Unsafe(Id) || RawTags.Contains(Id);
 	}
 
 	bool FTags::IsTagged(const FString& Key, const bool bInvert) const
 	{
+		return IsTagged(Key) ? !bInvert : bInvert;
+	}
+
+	bool FTags::TryGetTagValue(const FString& Key, FTagValue& OutValue) const
+	{
+		const FTagId Id = FTagTable::Find(Key);
+		if (!Id.IsValid()) { return false; }
+
 		FReadScopeLock ReadScopeLock(TagsLock);
-		return (ValueTags.Contains(Key) || RawTags.Contains(Key)) ? !bInvert : bInvert;
+		if (const FTagValue* Value = FindValue_Unsafe(Id))
+		{
+			OutValue = *Value;
+			return true;
+		}
+
+		return false;
+	}
+
+	const FTagValue* FTags::FindValue_Unsafe(const FTagId& Id) const
+	{
+		for (const FValueTag& ValueTag : ValueTags) { if (ValueTag.Key == Id) { return &ValueTag.Value; } }
+		return nullptr;
 	}
 
 	void FTags::ParseAndAdd(const FString& InTag)
 	{
-		FString InKey = TEXT("");
+		int32 SepIndex = INDEX_NONE;
+		if (InTag.FindChar(TagSeparator[0], SepIndex) && SepIndex > 0 && SepIndex < InTag.Len() - 1)
+		{
+			SetValue_Unsafe(FTagTable::Intern(InTag.Left(SepIndex)), FTagValue::Parse(InTag.RightChop(SepIndex + 1)));
+			return;
+		}
 
-		if (const TSharedPtr<IDataValue> TagValue = TryGetValueFromTag(InTag, InKey))
+		AddRaw_Unsafe(FTagTable::Intern(InTag));
+	}
+
+	void FTags::AddRaw_Unsafe(const FTagId& Id)
+	{
+		if (!RawTags.Contains(Id)) { RawTags.Add(Id); }
+	}
+
+	void FTags::SetValue_Unsafe(const FTagId& Id, FTagValue&& InValue)
+	{
+		for (FValueTag& ValueTag : ValueTags)
 		{
-			ValueTags.Add(InKey, TagValue);
+			if (ValueTag.Key != Id) { continue; }
+
+			ValueTag.Key = Id;
+			ValueTag.Value = MoveTemp(InValue);
 			return;
 		}
 
-		RawTags.Add(InTag);
+		ValueTags.Add(FValueTag{Id, MoveTemp(InValue)});
+	}
+
+	void FTags::Remove_Unsafe(const FTagId& Id)
+	{
+		RawTags.Remove(Id);
+		ValueTags.RemoveAll([&Id](const FValueTag& ValueTag) { return ValueTag.Key == Id; });
 	}
 
 	bool FTags::GetTagFromString(const FString& Input, FString& OutKey, FString& OutValue)
@@ -195,4 +478,6 @@ namespace PCGExData
 		OutValue = Input.Mid(SepIndex + 1);
 		return !OutKey.IsEmpty();
 	}
+
+#pragma endregion
 }
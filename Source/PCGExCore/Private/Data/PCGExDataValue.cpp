@@ -67,6 +67,12 @@ template PCGEXCORE_API _TYPE IDataValue::GetValue<_TYPE>();
 		}
 	}
 
+	template <typename T>
+	TSharedPtr<IDataValue> TDataValue<T>::Clone() const
+	{
+		return MakeShared<TDataValue<T>>(Value);
+	}
+
 	template <typename T>
 	bool TDataValue<T>::IsNumeric() const
 	{
@@ -8,6 +8,7 @@
 #include "Core/PCGExContext.h"
 #include "PCGParamData.h"
 #include "Data/PCGExDataTags.h"
+#include "Data/Utils/PCGExAttributeColumnCache.h"
 #include "Data/PCGPointData.h"
 #include "Helpers/PCGExArrayHelpers.h"
 
@@ -98,6 +99,9 @@ namespace PCGExData
 		{
 			check(In);
 			Out = const_cast<UPCGBasePointData*>(In);
+
+			// Forwarded data may be written to in place from here on
+			FAttributeColumnCache::Get().Invalidate(In);
 			return true;
 		}
 
@@ -0,0 +1,143 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Data/Utils/PCGExAttributeColumnCache.h"
+
+#include "PCGExCoreSettingsCache.h"
+#include "PCGExSettingsCacheBody.h"
+#include "Data/PCGData.h"
+
+namespace PCGExData
+{
+	FAttributeColumnKey::FAttributeColumnKey(const UPCGData* InData, const FPCGMetadataAttributeBase* InAttribute, const uint64 InUID, const int32 InNum)
+		: Data(InData), Attribute(InAttribute), UID(InUID), Num(InNum)
+	{
+	}
+
+#pragma region FAttributeColumnCache
+
+	FAttributeColumnCache& FAttributeColumnCache::Get()
+	{
+		static FAttributeColumnCache Instance;
+		return Instance;
+	}
+
+	bool FAttributeColumnCache::CanCache(const int32 InNum) const
+	{
+		// Small columns decode faster than they would contend on the lock
+		return PCGEX_CORE_SETTINGS.AttributeColumnCacheBudgetMB > 0 && !PCGEX_CORE_SETTINGS.IsSmallPointSize(InNum);
+	}
+
+	void FAttributeColumnCache::Invalidate(const UPCGData* InData)
+	{
+		// Writes are far more frequent than cached data being written to. With the cache disabled (budget of 0)
+		// or simply empty this must not cost more than an atomic load.
+		if (!InData || NumData.load(std::memory_order_acquire) == 0) { return; }
+
+		const FObjectKey DataKey(InData);
+
+		{
+			FReadScopeLock ReadLock(Lock);
+			if (!Entries.Contains(DataKey)) { return; }
+		}
+
+		FWriteScopeLock WriteLock(Lock);
+		RemoveDataUnsafe(DataKey);
+	}
+
+	void FAttributeColumnCache::Empty()
+	{
+		FWriteScopeLock WriteLock(Lock);
+		Entries.Empty();
+		NumData.store(0, std::memory_order_release);
+		TotalBytes = 0;
+	}
+
+	TSharedPtr<FAttributeColumnCache::IColumn> FAttributeColumnCache::FindColumn(const FAttributeColumnKey& Key)
+	{
+		FReadScopeLock ReadLock(Lock);
+
+		const FDataColumns* Columns = Entries.Find(Key.Data);
+		if (!Columns) { return nullptr; }
+
+		const TSharedPtr<FEntry>* Entry = Columns->Find(Key);
+		if (!Entry) { return nullptr; }
+
+		(*Entry)->LastUse.store(++UseCounter, std::memory_order_relaxed);
+		return (*Entry)->Column;
+	}
+
+	void FAttributeColumnCache::AddColumn(const FAttributeColumnKey& Key, const TSharedPtr<IColumn>& Column, const int64 Bytes)
+	{
+		const int64 Budget = static_cast<int64>(PCGEX_CORE_SETTINGS.AttributeColumnCacheBudgetMB) * 1024 * 1024;
+		if (Bytes > Budget) { return; }
+
+		FWriteScopeLock WriteLock(Lock);
+
+		// Columns of released data would otherwise linger until evicted
+		PurgeUnsafe();
+
+		FDataColumns& Columns = Entries.FindOrAdd(Key.Data);
+		NumData.store(Entries.Num(), std::memory_order_release);
+
+		// Another reader may have published the same column concurrently; keep the first one
+		if (Columns.Contains(Key)) { return; }
+
+		const TSharedPtr<FEntry> Entry = MakeShared<FEntry>();
+		Entry->Column = Column;
+		Entry->Bytes = Bytes;
+		Entry->LastUse.store(++UseCounter, std::memory_order_relaxed);
+
+		Columns.Add(Key, Entry);
+		TotalBytes += Bytes;
+
+		if (TotalBytes > Budget) { EvictUnsafe(Budget); }
+	}
+
+	void FAttributeColumnCache::PurgeUnsafe()
+	{
+		for (auto It = Entries.CreateIterator(); It; ++It)
+		{
+			if (It->Key.ResolveObjectPtr()) { continue; }
+			for (const TPair<FAttributeColumnKey, TSharedPtr<FEntry>>& Pair : It->Value) { TotalBytes -= Pair.Value->Bytes; }
+			It.RemoveCurrent();
+		}
+
+		NumData.store(Entries.Num(), std::memory_order_release);
+	}
+
+	void FAttributeColumnCache::EvictUnsafe(const int64 Budget)
+	{
+		TArray<TPair<uint64, FAttributeColumnKey>> ByAge;
+		for (const TPair<FObjectKey, FDataColumns>& Data : Entries)
+		{
+			for (const TPair<FAttributeColumnKey, TSharedPtr<FEntry>>& Pair : Data.Value) { ByAge.Emplace(Pair.Value->LastUse.load(std::memory_order_relaxed), Pair.Key); }
+		}
+		ByAge.Sort([](const TPair<uint64, FAttributeColumnKey>& A, const TPair<uint64, FAttributeColumnKey>& B) { return A.Key < B.Key; });
+
+		for (const TPair<uint64, FAttributeColumnKey>& Oldest : ByAge)
+		{
+			if (TotalBytes <= Budget) { break; }
+
+			FDataColumns* Columns = Entries.Find(Oldest.Value.Data);
+			if (!Columns) { continue; }
+
+			TSharedPtr<FEntry> Removed;
+			if (Columns->RemoveAndCopyValue(Oldest.Value, Removed)) { TotalBytes -= Removed->Bytes; }
+			if (Columns->IsEmpty()) { Entries.Remove(Oldest.Value.Data); }
+		}
+
+		NumData.store(Entries.Num(), std::memory_order_release);
+	}
+
+	void FAttributeColumnCache::RemoveDataUnsafe(const FObjectKey& DataKey)
+	{
+		FDataColumns Removed;
+		if (!Entries.RemoveAndCopyValue(DataKey, Removed)) { return; }
+
+		for (const TPair<FAttributeColumnKey, TSharedPtr<FEntry>>& Pair : Removed) { TotalBytes -= Pair.Value->Bytes; }
+		NumData.store(Entries.Num(), std::memory_order_release);
+	}
+
+#pragma endregion
+}
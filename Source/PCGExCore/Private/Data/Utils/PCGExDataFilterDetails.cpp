@@ -144,8 +144,17 @@ void FPCGExCarryOverDetails::Prune(PCGExData::FTags* InTags) const
 	}
 	else
 	{
-		for (const FString& Tag : InTags->RawTags) { if (!Tags.Test(Tag)) { ToBeRemoved.Add(Tag); } }
-		for (const TPair<FString, TSharedPtr<PCGExData::IDataValue>>& Pair : InTags->ValueTags) { if (!Tags.Test(Pair.Key)) { ToBeRemoved.Add(Pair.Key); } }
+		for (const PCGExData::FTagId& Id : InTags->GetRawTags_Unsafe())
+		{
+			const FString& Tag = PCGExData::FTagTable::ToString(Id);
+			if (!Tags.Test(Tag)) { ToBeRemoved.Add(Tag); }
+		}
+
+		for (const PCGExData::FValueTag& ValueTag : InTags->GetValueTags_Unsafe())
+		{
+			const FString& Tag = PCGExData::FTagTable::ToString(ValueTag.Key);
+			if (!Tags.Test(Tag)) { ToBeRemoved.Add(Tag); }
+		}
 	}
 
 	InTags->Remove(ToBeRemoved);
@@ -169,8 +178,8 @@ bool FPCGExCarryOverDetails::Test(PCGExData::FTags* InTags) const
 	}
 	else
 	{
-		for (const FString& Tag : InTags->RawTags) { if (!Tags.Test(Tag)) { return false; } }
-		for (const TPair<FString, TSharedPtr<PCGExData::IDataValue>>& Pair : InTags->ValueTags) { if (!Tags.Test(Pair.Key)) { return false; } }
+		for (const PCGExData::FTagId& Id : InTags->GetRawTags_Unsafe()) { if (!Tags.Test(PCGExData::FTagTable::ToString(Id))) { return false; } }
+		for (const PCGExData::FValueTag& ValueTag : InTags->GetValueTags_Unsafe()) { if (!Tags.Test(PCGExData::FTagTable::ToString(ValueTag.Key))) { return false; } }
 	}
 
 	return true;
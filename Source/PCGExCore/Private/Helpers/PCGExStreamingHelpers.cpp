@@ -13,6 +13,73 @@
 
 namespace PCGExHelpers
 {
+	namespace SharedStreamables
+	{
+		// Process-wide registry of streamable handles keyed by path, so concurrent executions
+		// requesting the same assets join the existing load instead of issuing their own.
+		// Entries are weak: a handle stays shareable only while some context still tracks it.
+		// Only ever touched from the game thread, where every streamable request is issued.
+		static TMap<FSoftObjectPath, TWeakPtr<FStreamableHandle>> Handles;
+		static int32 NumRegistrationsSincePrune = 0;
+
+		static TSharedPtr<FStreamableHandle> Find(const FSoftObjectPath& Path)
+		{
+			const TWeakPtr<FStreamableHandle>* WeakHandle = Handles.Find(Path);
+			if (!WeakHandle) { return nullptr; }
+
+			TSharedPtr<FStreamableHandle> Handle = WeakHandle->Pin();
+			return Handle && Handle->IsActive() ? Handle : nullptr;
+		}
+
+		static void Register(const TArray<FSoftObjectPath>& Paths, const TSharedPtr<FStreamableHandle>& Handle)
+		{
+			if (++NumRegistrationsSincePrune > 64)
+			{
+				NumRegistrationsSincePrune = 0;
+				for (auto It = Handles.CreateIterator(); It; ++It) { if (!It.Value().IsValid()) { It.RemoveCurrent(); } }
+			}
+
+			for (const FSoftObjectPath& Path : Paths) { Handles.Add(Path, Handle); }
+		}
+
+		// Joins the live handles already covering some of the paths and issues a single request for the rest.
+		// Whenever a pre-existing handle is involved the result is a combined handle, so binding
+		// delegates on it never overrides those of another requester.
+		static TSharedPtr<FStreamableHandle> Request(TArray<FSoftObjectPath>&& Paths, const bool bSynchronous)
+		{
+			check(IsInGameThread())
+
+			FStreamableManager& StreamableManager = UAssetManager::GetStreamableManager();
+
+			TArray<TSharedPtr<FStreamableHandle>> ExistingHandles;
+			TArray<FSoftObjectPath> MissingPaths;
+			MissingPaths.Reserve(Paths.Num());
+
+			for (const FSoftObjectPath& Path : Paths)
+			{
+				if (TSharedPtr<FStreamableHandle> Existing = Find(Path)) { ExistingHandles.AddUnique(Existing); }
+				else { MissingPaths.Add(Path); }
+			}
+
+			TSharedPtr<FStreamableHandle> NewHandle;
+			if (!MissingPaths.IsEmpty())
+			{
+				NewHandle = bSynchronous ? StreamableManager.RequestSyncLoad(MissingPaths) : StreamableManager.RequestAsyncLoad(MissingPaths);
+				if (NewHandle) { Register(MissingPaths, NewHandle); }
+			}
+
+			if (ExistingHandles.IsEmpty()) { return NewHandle; }
+
+			if (bSynchronous)
+			{
+				for (const TSharedPtr<FStreamableHandle>& Existing : ExistingHandles) { if (Existing->IsLoadingInProgress()) { Existing->WaitUntilComplete(); } }
+			}
+
+			if (NewHandle) { ExistingHandles.Add(NewHandle); }
+			return StreamableManager.CreateCombinedHandle(ExistingHandles);
+		}
+	}
+
 	TSharedPtr<FStreamableHandle> LoadBlocking_AnyThread(const FSoftObjectPath& Path, FPCGExContext* InContext)
 	{
 		// Thread-safe synchronous asset loading. UAssetManager requires game-thread access,
@@ -21,7 +88,7 @@ namespace PCGExHelpers
 		TSharedPtr<FStreamableHandle> Handle;
 		if (IsInGameThread())
 		{
-			Handle = UAssetManager::GetStreamableManager().RequestSyncLoad(Path);
+			Handle = SharedStreamables::Request({Path}, true);
 			if (InContext) { InContext->TrackAssetsHandle(Handle); }
 		}
 		else
@@ -37,7 +104,7 @@ namespace PCGExHelpers
 		TSharedPtr<FStreamableHandle> Handle;
 		if (IsInGameThread())
 		{
-			Handle = UAssetManager::GetStreamableManager().RequestSyncLoad(Paths->Array());
+			Handle = SharedStreamables::Request(Paths->Array(), true);
 			if (InContext) { InContext->TrackAssetsHandle(Handle); }
 		}
 		else
@@ -55,8 +122,9 @@ namespace PCGExHelpers
 		// Dispatches to game thread (required by UAssetManager), creates a LoadToken
 		// to keep the task manager alive during the async load, and fires OnLoadEnd
 		// when the streamable manager completes. The token is released in both the
-		// success callback and the early-completion/failure path to ensure the task
-		// group's completion count stays correct.
+		// completion/cancel callbacks and the early-completion/failure path to ensure
+		// the task group's completion count stays correct.
+		// Paths already being streamed for another execution are joined rather than requested twice.
 		PCGExMT::ExecuteOnMainThread(TaskManager, [GetPathsFunc, OnLoadEnd, TaskManager]()
 		{
 			TArray<FSoftObjectPath> Paths = GetPathsFunc();
@@ -68,21 +136,37 @@ namespace PCGExHelpers
 			}
 
 			TWeakPtr<PCGExMT::FAsyncToken> LoadToken = TaskManager->TryCreateToken(FName("LoadToken"));
-			const TSharedPtr<FStreamableHandle> LoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
-				MoveTemp(Paths),
-				[OnLoadEnd, LoadToken](TSharedPtr<FStreamableHandle> InHandle) // NOLINT(performance-unnecessary-value-param)
-				{
-					OnLoadEnd(true, InHandle);
-					PCGEX_ASYNC_RELEASE_CAPTURED_TOKEN(LoadToken)
-				});
+			const TSharedPtr<FStreamableHandle> LoadHandle = SharedStreamables::Request(MoveTemp(Paths), false);
 
-			// Handle already-completed or failed loads (assets were cached or paths invalid).
-			if (!LoadHandle || !LoadHandle->IsActive())
+			// Handle already-completed or failed loads (assets were cached, shared with a finished request, or paths invalid).
+			if (!LoadHandle || !LoadHandle->IsLoadingInProgress())
 			{
-				if (!LoadHandle || !LoadHandle->HasLoadCompleted()) { OnLoadEnd(false, LoadHandle); }
-				else { OnLoadEnd(true, LoadHandle); }
+				OnLoadEnd(LoadHandle && LoadHandle->HasLoadCompleted(), LoadHandle);
 				PCGEX_ASYNC_RELEASE_TOKEN(LoadToken)
+				return;
 			}
+
+			// Combined handles are only weakly referenced by their children, so the callbacks own the handle
+			// until one of them fires, then drop it to break the cycle.
+			TSharedPtr<TSharedPtr<FStreamableHandle>> PendingHandle = MakeShared<TSharedPtr<FStreamableHandle>>(LoadHandle);
+
+			LoadHandle->BindCompleteDelegate(
+				FStreamableDelegate::CreateLambda(
+					[OnLoadEnd, LoadToken, PendingHandle]()
+					{
+						const TSharedPtr<FStreamableHandle> Handle = MoveTemp(*PendingHandle.Get());
+						OnLoadEnd(true, Handle);
+						PCGEX_ASYNC_RELEASE_CAPTURED_TOKEN(LoadToken)
+					}));
+
+			LoadHandle->BindCancelDelegate(
+				FStreamableDelegate::CreateLambda(
+					[OnLoadEnd, LoadToken, PendingHandle]()
+					{
+						const TSharedPtr<FStreamableHandle> Handle = MoveTemp(*PendingHandle.Get());
+						OnLoadEnd(false, Handle);
+						PCGEX_ASYNC_RELEASE_CAPTURED_TOKEN(LoadToken)
+					}));
 		});
 	}
 
@@ -10,11 +10,115 @@
 #include "Math/Geo/PCGExPrimtives.h"
 #include "ThirdParty/Delaunator/include/delaunator.hpp"
 #include "Async/ParallelFor.h"
+#include "Algo/Unique.h"
 #include "Math/Geo/PCGExGeo.h"
 #include "Math/PCGExProjectionDetails.h"
+#include "Sorting/PCGExSortingHelpers.h"
 
 namespace PCGExMath::Geo
 {
+	namespace
+	{
+		// Skilling's transpose-based Hilbert index, 21 bits per axis
+		uint64 Hilbert3(const uint32 X, const uint32 Y, const uint32 Z)
+		{
+			constexpr int32 Bits = 21;
+			constexpr uint32 M = 1u << (Bits - 1);
+
+			uint32 V[3] = {X, Y, Z};
+
+			for (uint32 Q = M; Q > 1; Q >>= 1)
+			{
+				const uint32 P = Q - 1;
+				for (int32 i = 0; i < 3; i++)
+				{
+					if (V[i] & Q) { V[0] ^= P; }
+					else
+					{
+						const uint32 T = (V[0] ^ V[i]) & P;
+						V[0] ^= T;
+						V[i] ^= T;
+					}
+				}
+			}
+
+			for (int32 i = 1; i < 3; i++) { V[i] ^= V[i - 1]; }
+
+			uint32 T = 0;
+			for (uint32 Q = M; Q > 1; Q >>= 1) { if (V[2] & Q) { T ^= Q - 1; } }
+			for (int32 i = 0; i < 3; i++) { V[i] ^= T; }
+
+			uint64 Key = 0;
+			for (int32 b = Bits - 1; b >= 0; b--)
+			{
+				for (int32 i = 0; i < 3; i++) { Key = (Key << 1) | ((V[i] >> b) & 1); }
+			}
+
+			return Key;
+		}
+
+		template <typename TSite>
+		void RemoveSiteLongestEdges(const TArray<TSite>& Sites, const TArrayView<FVector>& Positions, TArray<uint64>& Edges, TSet<uint64>* OutLongestEdges)
+		{
+			const int32 NumSites = Sites.Num();
+
+			TArray<uint64> Longest;
+			Longest.SetNumUninitialized(NumSites);
+
+			ParallelFor(NumSites, [&](const int32 i) { GetLongestEdge(Positions, Sites[i].Vtx, Longest[i]); }, NumSites < 1024);
+
+			PCGExSortingHelpers::ParallelRadixSort(Longest);
+			Longest.SetNum(Algo::Unique(Longest));
+
+			// Both lists are sorted, drop matches in a single merge pass
+			int32 WriteIndex = 0;
+			int32 j = 0;
+			for (int32 i = 0; i < Edges.Num(); i++)
+			{
+				const uint64 Edge = Edges[i];
+				while (j < Longest.Num() && Longest[j] < Edge) { j++; }
+				if (j < Longest.Num() && Longest[j] == Edge) { continue; }
+				Edges[WriteIndex++] = Edge;
+			}
+
+			Edges.SetNum(WriteIndex);
+
+			if (OutLongestEdges) { OutLongestEdges->Append(Longest); }
+		}
+	}
+
+	void HilbertOrder(const TArrayView<const FVector>& Positions, TArray<int32>& OutOrder)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExGeo::HilbertOrder);
+
+		const int32 NumPositions = Positions.Num();
+
+		FBox Bounds = FBox(ForceInit);
+		for (const FVector& P : Positions) { Bounds += P; }
+
+		const FVector Min = Bounds.Min;
+		const FVector Scale = FVector(2097151.0) / FVector::Max(Bounds.GetSize(), FVector(UE_SMALL_NUMBER));
+
+		TArray<PCGEx::FIndexKey> Keys;
+		Keys.SetNumUninitialized(NumPositions);
+
+		ParallelFor(
+			NumPositions, [&](const int32 i)
+			{
+				const FVector N = (Positions[i] - Min) * Scale;
+				Keys[i] = PCGEx::FIndexKey(
+					i, Hilbert3(
+						static_cast<uint32>(FMath::Clamp(N.X, 0.0, 2097151.0)),
+						static_cast<uint32>(FMath::Clamp(N.Y, 0.0, 2097151.0)),
+						static_cast<uint32>(FMath::Clamp(N.Z, 0.0, 2097151.0))));
+			}, NumPositions < 1024);
+
+		PCGExSortingHelpers::ParallelRadixSort(Keys);
+
+		OutOrder.SetNumUninitialized(NumPositions);
+		for (int32 i = 0; i < NumPositions; i++) { OutOrder[i] = Keys[i].Index; }
+	}
+
 	FDelaunaySite2::FDelaunaySite2(const UE::Geometry::FIndex3i& InVtx, const UE::Geometry::FIndex3i& InAdjacency, const int32 InId)
 		: Id(InId)
 	{
@@ -77,35 +181,9 @@ namespace PCGExMath::Geo
 
 		if (const int32 NumPositions = Positions.Num(); Positions.IsEmpty() || NumPositions <= 2) { return false; }
 
-		TMap<uint64, int32> EdgeMap;
-
 		{
 			TRACE_CPUPROFILER_EVENT_SCOPE(Delaunator::Triangulate);
 
-			IsValid = true;
-			// Build adjacency by matching shared edges between triangles.
-			// First occurrence of an edge records the owning site in EdgeMap.
-			// Second occurrence means two triangles share that edge, so they become neighbors.
-			// Unmatched edges (still in EdgeMap after all sites) are convex hull edges.
-			auto PushEdge = [&](FDelaunaySite2& Site, const uint64 Edge)
-			{
-				bool bIsAlreadySet = false;
-				DelaunayEdges.Add(Edge, &bIsAlreadySet);
-				if (bIsAlreadySet)
-				{
-					if (int32 Idx = -1; EdgeMap.RemoveAndCopyValue(Edge, Idx))
-					{
-						FDelaunaySite2& OtherSite = Sites[Idx];
-						OtherSite.PushAdjacency(Site.Id);
-						Site.PushAdjacency(OtherSite.Id);
-					}
-				}
-				else
-				{
-					EdgeMap.Add(Edge, Site.Id);
-				}
-			};
-
 			if (PCGEX_CORE_SETTINGS.bUseDelaunator)
 			{
 				std::vector<double> OutVector(Positions.Num() * 2);
@@ -120,24 +198,33 @@ namespace PCGExMath::Geo
 				if (!NumTriangles) { return false; }
 
 				const int32 NumSites = NumTriangles / 3;
-				DelaunayEdges.Reserve(NumSites);
-				Sites.Reserve(NumSites);
-				EdgeMap.Reserve(NumSites);
+				Sites.SetNumUninitialized(NumSites);
 
-				int32 s = 0;
-				for (std::size_t i = 0; i < NumTriangles; i += 3)
-				{
-					FDelaunaySite2& Site = Sites.Emplace_GetRef(d.triangles[i], d.triangles[i + 1], d.triangles[i + 2], s++);
-					PushEdge(Site, Site.AB());
-					PushEdge(Site, Site.BC());
-					PushEdge(Site, Site.AC());
-				}
+				ParallelFor(
+					NumSites, [&](const int32 i)
+					{
+						const std::size_t t = static_cast<std::size_t>(i) * 3;
+						Sites[i] = FDelaunaySite2(d.triangles[t], d.triangles[t + 1], d.triangles[t + 2], i);
+					}, NumSites < 1024);
 			}
 			else
 			{
 				TArray<FVector2D> OutVector;
 				ProjectionDetails.Project(Positions, OutVector);
 
+				// Insert along a Hilbert curve for locality, then remap triangles to the original indices
+				TArray<int32> Order;
+				if (PCGEX_CORE_SETTINGS.bDelaunayHilbertSort)
+				{
+					TArray<FVector> Projected;
+					Projected.SetNumUninitialized(OutVector.Num());
+					for (int32 i = 0; i < OutVector.Num(); i++) { Projected[i] = FVector(OutVector[i], 0); }
+
+					HilbertOrder(Projected, Order);
+
+					for (int32 i = 0; i < Order.Num(); i++) { OutVector[i] = FVector2D(Projected[Order[i]]); }
+				}
+
 				UE::Geometry::FDelaunay2 Delaunay2;
 				if (!Delaunay2.Triangulate(OutVector)) { return false; }
 
@@ -146,76 +233,82 @@ namespace PCGExMath::Geo
 
 				if (!NumTriangles) { return false; }
 
-				const int32 NumSites = NumTriangles / 3;
-				DelaunayEdges.Reserve(NumSites);
-				Sites.Reserve(NumSites);
-				EdgeMap.Reserve(NumSites);
+				Sites.SetNumUninitialized(NumTriangles);
 
-				int32 s = 0;
-				for (const UE::Geometry::FIndex3i& T : Triangles)
-				{
-					FDelaunaySite2& Site = Sites.Emplace_GetRef(T.A, T.B, T.C, s++);
-					PushEdge(Site, Site.AB());
-					PushEdge(Site, Site.BC());
-					PushEdge(Site, Site.AC());
-				}
+				ParallelFor(
+					NumTriangles, [&](const int32 i)
+					{
+						const UE::Geometry::FIndex3i& T = Triangles[i];
+						if (Order.IsEmpty()) { Sites[i] = FDelaunaySite2(T.A, T.B, T.C, i); }
+						else { Sites[i] = FDelaunaySite2(Order[T.A], Order[T.B], Order[T.C], i); }
+					}, NumTriangles < 1024);
 			}
 
-			DelaunayEdges.Shrink();
-			DelaunayHull.Reserve(DelaunayEdges.Num() / 3);
+			IsValid = true;
 		}
 
-		{
-			TRACE_CPUPROFILER_EVENT_SCOPE(Delaunay2D::FillHullSites);
+		BuildEdges();
+
+		return IsValid;
+	}
+
+	void TDelaunay2::BuildEdges()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(Delaunay2D::BuildEdges);
+
+		// One record per site edge, keyed by edge hash. Once sorted, each edge is a run of one or two records :
+		// two records means the sites are neighbors, a single one is a convex hull edge.
+		const int32 NumSites = Sites.Num();
+		const int32 NumRecords = NumSites * 3;
+
+		TArray<PCGEx::FIndexKey> Records;
+		Records.SetNumUninitialized(NumRecords);
 
-			for (const FDelaunaySite2& Site : Sites)
+		ParallelFor(
+			NumSites, [&](const int32 i)
 			{
-				if (Site.bOnHull)
-				{
-					// Push edges that are still waiting to be matched
-					if (EdgeMap.Contains(Site.AB()))
-					{
-						DelaunayHull.Add(Site.Vtx[0]);
-						DelaunayHull.Add(Site.Vtx[1]);
-					}
+				const FDelaunaySite2& Site = Sites[i];
+				PCGEx::FIndexKey* Record = Records.GetData() + i * 3;
+				Record[0] = PCGEx::FIndexKey(i, Site.AB());
+				Record[1] = PCGEx::FIndexKey(i, Site.BC());
+				Record[2] = PCGEx::FIndexKey(i, Site.AC());
+			}, NumSites < 1024);
 
-					if (EdgeMap.Contains(Site.BC()))
-					{
-						DelaunayHull.Add(Site.Vtx[1]);
-						DelaunayHull.Add(Site.Vtx[2]);
-					}
+		PCGExSortingHelpers::ParallelRadixSort(Records);
 
-					if (EdgeMap.Contains(Site.AC()))
-					{
-						DelaunayHull.Add(Site.Vtx[0]);
-						DelaunayHull.Add(Site.Vtx[2]);
-					}
-				}
+		DelaunayEdges.Reserve(NumRecords / 2 + 1);
+
+		for (int32 i = 0; i < NumRecords;)
+		{
+			const uint64 Edge = Records[i].Key;
+			DelaunayEdges.Add(Edge);
+
+			if (i + 1 < NumRecords && Records[i + 1].Key == Edge)
+			{
+				FDelaunaySite2& Site = Sites[Records[i].Index];
+				FDelaunaySite2& OtherSite = Sites[Records[i + 1].Index];
+				Site.PushAdjacency(OtherSite.Id);
+				OtherSite.PushAdjacency(Site.Id);
+				i += 2;
+				continue;
 			}
+
+			DelaunayHull.Add(PCGEx::H64A(Edge));
+			DelaunayHull.Add(PCGEx::H64B(Edge));
+			i++;
 		}
 
-		return IsValid;
+		DelaunayEdges.Shrink();
 	}
 
 	void TDelaunay2::RemoveLongestEdges(const TArrayView<FVector>& Positions)
 	{
-		uint64 Edge;
-		for (const FDelaunaySite2& Site : Sites)
-		{
-			GetLongestEdge(Positions, Site.Vtx, Edge);
-			DelaunayEdges.Remove(Edge);
-		}
+		RemoveSiteLongestEdges(Sites, Positions, DelaunayEdges, nullptr);
 	}
 
 	void TDelaunay2::RemoveLongestEdges(const TArrayView<FVector>& Positions, TSet<uint64>& LongestEdges)
 	{
-		uint64 Edge;
-		for (const FDelaunaySite2& Site : Sites)
-		{
-			GetLongestEdge(Positions, Site.Vtx, Edge);
-			DelaunayEdges.Remove(Edge);
-			LongestEdges.Add(Edge);
-		}
+		RemoveSiteLongestEdges(Sites, Positions, DelaunayEdges, &LongestEdges);
 	}
 
 	void TDelaunay2::GetMergedSites(const int32 SiteIndex, const TSet<uint64>& EdgeConnectors, TSet<int32>& OutMerged, TSet<uint64>& OutUEdges, TBitArray<>& VisitedSites)
@@ -283,28 +376,134 @@ namespace PCGExMath::Geo
 		Sites.Empty();
 		DelaunayEdges.Empty();
 		DelaunayHull.Empty();
+		Adjacency.Empty();
 
 		IsValid = false;
 	}
 
-	void TDelaunay3::RemoveLongestEdges(const TArrayView<FVector>& Positions)
+	bool TDelaunay3::Triangulate(const TArrayView<FVector>& Positions, TArray<FIntVector4>& OutTetrahedra) const
 	{
-		uint64 Edge;
-		for (const FDelaunaySite3& Site : Sites)
+		TRACE_CPUPROFILER_EVENT_SCOPE(Delaunay3D::Triangulate);
+
+		UE::Geometry::FDelaunay3 Tetrahedralization;
+
+		if (!PCGEX_CORE_SETTINGS.bDelaunayHilbertSort)
 		{
-			GetLongestEdge(Positions, Site.Vtx, Edge);
-			DelaunayEdges.Remove(Edge);
+			if (!Tetrahedralization.Triangulate(Positions)) { return false; }
+			OutTetrahedra = Tetrahedralization.GetTetrahedra();
+			return true;
 		}
+
+		// Insert along a Hilbert curve for locality, then remap tetrahedra to the original indices
+		TArray<int32> Order;
+		HilbertOrder(Positions, Order);
+
+		TArray<FVector> Sorted;
+		Sorted.SetNumUninitialized(Order.Num());
+		for (int32 i = 0; i < Order.Num(); i++) { Sorted[i] = Positions[Order[i]]; }
+
+		if (!Tetrahedralization.Triangulate(Sorted)) { return false; }
+
+		OutTetrahedra = Tetrahedralization.GetTetrahedra();
+		ParallelFor(
+			OutTetrahedra.Num(), [&](const int32 i)
+			{
+				FIntVector4& T = OutTetrahedra[i];
+				T = FIntVector4(Order[T.X], Order[T.Y], Order[T.Z], Order[T.W]);
+			}, OutTetrahedra.Num() < 1024);
+
+		return true;
 	}
 
-	void TDelaunay3::RemoveLongestEdges(const TArrayView<FVector>& Positions, TSet<uint64>& LongestEdges)
+	void TDelaunay3::BuildSites(const TArray<FIntVector4>& Tetrahedra, const bool bComputeFaces)
 	{
-		uint64 Edge;
-		for (const FDelaunaySite3& Site : Sites)
+		TRACE_CPUPROFILER_EVENT_SCOPE(Delaunay3D::BuildSites);
+
+		// Each site emits its six edges into its own slice of a flat array, which is then sorted and deduplicated
+		const int32 NumSites = Tetrahedra.Num();
+		Sites.SetNumUninitialized(NumSites);
+
+		TArray<uint64> Edges;
+		Edges.SetNumUninitialized(NumSites * 6);
+
+		ParallelFor(
+			NumSites, [&](const int32 i)
+			{
+				Sites[i] = FDelaunaySite3(Tetrahedra[i], i);
+				FDelaunaySite3& Site = Sites[i];
+
+				uint64* Edge = Edges.GetData() + i * 6;
+				for (int a = 0; a < 4; a++)
+				{
+					for (int b = a + 1; b < 4; b++) { *Edge++ = PCGEx::H64U(Site.Vtx[a], Site.Vtx[b]); }
+				}
+
+				if (bComputeFaces) { Site.ComputeFaces(); }
+			}, NumSites < 1024);
+
+		PCGExSortingHelpers::ParallelRadixSort(Edges);
+		Edges.SetNum(Algo::Unique(Edges));
+		Edges.Shrink();
+
+		DelaunayEdges = MoveTemp(Edges);
+	}
+
+	void TDelaunay3::BuildFaces(const bool bComputeAdjacency, const bool bComputeHull)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(Delaunay3D::BuildFaces);
+
+		// One record per site face, face hash in the high bits and face slot (site * 4 + face) in the low bits.
+		// Once sorted, faces shared by two sites are pairs of consecutive records; unpaired ones are on the hull.
+		const int32 NumSites = Sites.Num();
+		const int32 NumRecords = NumSites * 4;
+
+		TArray<uint64> Records;
+		Records.SetNumUninitialized(NumRecords);
+
+		ParallelFor(
+			NumSites, [&](const int32 i)
+			{
+				const FDelaunaySite3& Site = Sites[i];
+				for (int f = 0; f < 4; f++) { Records[i * 4 + f] = PCGEx::H64(Site.Faces[f], i * 4 + f); }
+			}, NumSites < 1024);
+
+		PCGExSortingHelpers::ParallelRadixSort(Records);
+
+		if (bComputeAdjacency) { Adjacency.Reserve(NumRecords / 2 + 1); }
+
+		for (int32 i = 0; i < NumRecords;)
 		{
-			GetLongestEdge(Positions, Site.Vtx, Edge);
-			DelaunayEdges.Remove(Edge);
-			LongestEdges.Add(Edge);
+			const uint32 Face = PCGEx::H64A(Records[i]);
+			const int32 Slot = static_cast<int32>(PCGEx::H64B(Records[i]));
+
+			if (i + 1 < NumRecords && PCGEx::H64A(Records[i + 1]) == Face)
+			{
+				if (bComputeAdjacency) { Adjacency.Add(PCGEx::NH64(static_cast<int32>(PCGEx::H64B(Records[i + 1])) / 4, Slot / 4)); }
+				i += 2;
+				continue;
+			}
+
+			if (bComputeAdjacency) { Adjacency.Add(PCGEx::NH64(-1, Slot / 4)); }
+
+			if (bComputeHull)
+			{
+				FDelaunaySite3& Site = Sites[Slot / 4];
+				const int32 f = Slot % 4;
+				for (int fi = 0; fi < 3; fi++) { DelaunayHull.Add(Site.Vtx[MTX[f][fi]]); }
+				Site.bOnHull = true;
+			}
+
+			i++;
 		}
 	}
+
+	void TDelaunay3::RemoveLongestEdges(const TArrayView<FVector>& Positions)
+	{
+		RemoveSiteLongestEdges(Sites, Positions, DelaunayEdges, nullptr);
+	}
+
+	void TDelaunay3::RemoveLongestEdges(const TArrayView<FVector>& Positions, TSet<uint64>& LongestEdges)
+	{
+		RemoveSiteLongestEdges(Sites, Positions, DelaunayEdges, &LongestEdges);
+	}
 }
@@ -372,11 +372,11 @@ namespace PCGExMath::Geo
 				GetCentroid(Positions, Site.Vtx, Centroids[Site.Id]);
 			}
 
-			for (const TPair<uint32, uint64>& AdjacencyPair : Delaunay->Adjacency)
+			for (const uint64 AdjacencyPair : Delaunay->Adjacency)
 			{
 				int32 A = -1;
 				int32 B = -1;
-				PCGEx::NH64(AdjacencyPair.Value, A, B);
+				PCGEx::NH64(AdjacencyPair, A, B);
 
 				if (A == -1 || B == -1) { continue; }
 
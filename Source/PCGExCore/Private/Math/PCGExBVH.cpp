@@ -0,0 +1,150 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Math/PCGExBVH.h"
+
+#include "PCGExH.h"
+#include "Async/ParallelFor.h"
+
+namespace PCGExBVH
+{
+	namespace
+	{
+		FORCEINLINE uint64 Part1By2(uint64 V)
+		{
+			V &= 0x1FFFFF;
+			V = (V | (V << 32)) & 0x1F00000000FFFF;
+			V = (V | (V << 16)) & 0x1F0000FF0000FF;
+			V = (V | (V << 8)) & 0x100F00F00F00F00F;
+			V = (V | (V << 4)) & 0x10C30C30C30C30C3;
+			V = (V | (V << 2)) & 0x1249249249249249;
+			return V;
+		}
+	}
+
+	void FBVH::Build(TArray<FItem>&& InItems, const int32 InLeafSize)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FBVH::Build);
+
+		Nodes.Reset();
+		ItemBounds.Reset();
+		ItemIndices.Reset();
+		Root = -1;
+
+		const int32 NumItems = InItems.Num();
+		if (!NumItems) { return; }
+
+		const int32 LeafSize = FMath::Max(1, InLeafSize);
+		const bool bInline = NumItems < 1024;
+
+		// Morton-order items by bounds center
+		FBox Centers = FBox(ForceInit);
+		for (const FItem& Item : InItems) { Centers += Item.Bounds.GetCenter(); }
+
+		const FVector Min = Centers.Min;
+		const FVector InvSize = FVector(1) / FVector::Max(Centers.GetSize(), FVector(UE_SMALL_NUMBER));
+
+		TArray<PCGEx::FIndexKey> Keys;
+		Keys.SetNumUninitialized(NumItems);
+
+		ParallelFor(
+			NumItems, [&](const int32 i)
+			{
+				const FVector N = (InItems[i].Bounds.GetCenter() - Min) * InvSize * 2097151.0;
+				Keys[i] = PCGEx::FIndexKey(
+					i,
+					Part1By2(static_cast<uint64>(FMath::Clamp(N.X, 0.0, 2097151.0))) |
+					(Part1By2(static_cast<uint64>(FMath::Clamp(N.Y, 0.0, 2097151.0))) << 1) |
+					(Part1By2(static_cast<uint64>(FMath::Clamp(N.Z, 0.0, 2097151.0))) << 2));
+			}, bInline);
+
+		Keys.Sort([](const PCGEx::FIndexKey& A, const PCGEx::FIndexKey& B) { return A.Key == B.Key ? A.Index < B.Index : A.Key < B.Key; });
+
+		ItemBounds.SetNumUninitialized(NumItems);
+		ItemIndices.SetNumUninitialized(NumItems);
+
+		ParallelFor(
+			NumItems, [&](const int32 i)
+			{
+				const FItem& Item = InItems[Keys[i].Index];
+				ItemBounds[i] = Item.Bounds;
+				ItemIndices[i] = Item.Index;
+			}, bInline);
+
+		InItems.Empty();
+		Keys.Empty();
+
+		// Leaves
+		const int32 NumLeaves = FMath::DivideAndRoundUp(NumItems, LeafSize);
+
+		int32 TotalNodes = 0;
+		for (int32 LevelNum = NumLeaves; ; LevelNum = FMath::DivideAndRoundUp(LevelNum, 2))
+		{
+			TotalNodes += LevelNum;
+			if (LevelNum == 1) { break; }
+		}
+
+		Nodes.SetNum(TotalNodes);
+
+		ParallelFor(
+			NumLeaves, [&](const int32 i)
+			{
+				FNode& Leaf = Nodes[i];
+				Leaf.Left = i * LeafSize;
+				Leaf.Count = FMath::Min(LeafSize, NumItems - Leaf.Left);
+				Leaf.Bounds = FBox(ForceInit);
+				for (int32 j = 0; j < Leaf.Count; j++) { Leaf.Bounds += ItemBounds[Leaf.Left + j]; }
+			}, NumLeaves < 256);
+
+		// Pair consecutive nodes level by level until a single root remains
+		int32 LevelStart = 0;
+		int32 LevelNum = NumLeaves;
+
+		while (LevelNum > 1)
+		{
+			const int32 ParentStart = LevelStart + LevelNum;
+			const int32 ParentNum = FMath::DivideAndRoundUp(LevelNum, 2);
+
+			ParallelFor(
+				ParentNum, [&](const int32 i)
+				{
+					FNode& Parent = Nodes[ParentStart + i];
+					Parent.Left = LevelStart + i * 2;
+					Parent.Right = i * 2 + 1 < LevelNum ? Parent.Left + 1 : -1;
+					Parent.Bounds = Nodes[Parent.Left].Bounds;
+					if (Parent.Right != -1) { Parent.Bounds += Nodes[Parent.Right].Bounds; }
+				}, ParentNum < 256);
+
+			LevelStart = ParentStart;
+			LevelNum = ParentNum;
+		}
+
+		Root = LevelStart;
+	}
+
+	bool FBVH::HasElementsWithBoundsTest(const FBox& InQuery) const
+	{
+		if (Root == -1) { return false; }
+
+		TArray<int32, TInlineAllocator<64>> Stack;
+		Stack.Add(Root);
+
+		while (!Stack.IsEmpty())
+		{
+			const FNode& Node = Nodes[Stack.Pop(EAllowShrinking::No)];
+			if (!Node.Bounds.Intersect(InQuery)) { continue; }
+
+			if (Node.IsLeaf())
+			{
+				const int32 End = Node.Left + Node.Count;
+				for (int32 i = Node.Left; i < End; i++) { if (ItemBounds[i].Intersect(InQuery)) { return true; } }
+				continue;
+			}
+
+			Stack.Add(Node.Left);
+			if (Node.Right != -1) { Stack.Add(Node.Right); }
+		}
+
+		return false;
+	}
+}
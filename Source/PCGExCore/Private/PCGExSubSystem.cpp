@@ -11,6 +11,11 @@
 #include "Engine/World.h"
 #endif
 
+#include "PCGComponent.h"
+#include "Async/Async.h"
+#include "Engine/Level.h"
+#include "GameFramework/Actor.h"
+
 UPCGExSubSystem::UPCGExSubSystem()
 	: Super()
 {
@@ -23,6 +28,14 @@ void UPCGExSubSystem::Initialize(FSubsystemCollectionBase& Collection)
 
 void UPCGExSubSystem::Deinitialize()
 {
+	UnbindActorEvents();
+
+	{
+		FWriteScopeLock WriteScopeLock(ActorWatchLock);
+		ActorWatchers.Empty();
+		TagWatchers.Empty();
+	}
+
 	Super::Deinitialize();
 }
 
@@ -167,3 +180,207 @@ void UPCGExSubSystem::ExecuteBeginTickActions()
 	for (const PCGEx::FPolledEvent& Event : Events) { OnGlobalEvent.Broadcast(Event.Source, Event.Type, Event.EventId); }
 	for (FTickAction& Action : Actions) { Action(); }
 }
+
+#pragma region Actor watch
+
+// Watchers are keyed by exact actor path or component tag, so each engine event costs a few map lookups per added actor
+// regardless of how many waiters exist. Engine delegates are only bound while someone is watching.
+void UPCGExSubSystem::WatchActor(const FSoftObjectPath& InActorPath, const void* InOwner, FOnActorEvent&& Callback)
+{
+	FSoftObjectPath Key = InActorPath;
+#if WITH_EDITOR
+	Key.FixupForPIE();
+#endif
+
+	bool bWasEmpty = false;
+
+	{
+		FWriteScopeLock WriteScopeLock(ActorWatchLock);
+		bWasEmpty = !HasWatchersUnsafe();
+		ActorWatchers.FindOrAdd(Key).Add(FActorWatcher{InOwner, MoveTemp(Callback)});
+	}
+
+	if (bWasEmpty) { RequestActorEventsUpdate(); }
+}
+
+void UPCGExSubSystem::WatchComponentTag(const FName InTag, const void* InOwner, FOnActorEvent&& Callback)
+{
+	if (InTag.IsNone()) { return; }
+
+	bool bWasEmpty = false;
+
+	{
+		FWriteScopeLock WriteScopeLock(ActorWatchLock);
+		bWasEmpty = !HasWatchersUnsafe();
+		TagWatchers.FindOrAdd(InTag).Add(FActorWatcher{InOwner, MoveTemp(Callback)});
+	}
+
+	if (bWasEmpty) { RequestActorEventsUpdate(); }
+}
+
+void UPCGExSubSystem::UnwatchActors(const void* InOwner)
+{
+	bool bBecameEmpty = false;
+
+	{
+		FWriteScopeLock WriteScopeLock(ActorWatchLock);
+		if (!HasWatchersUnsafe()) { return; }
+
+		auto RemoveOwner = [InOwner](auto& Watchers)
+		{
+			for (auto It = Watchers.CreateIterator(); It; ++It)
+			{
+				It->Value.RemoveAll([InOwner](const FActorWatcher& Watcher) { return Watcher.Owner == InOwner; });
+				if (It->Value.IsEmpty()) { It.RemoveCurrent(); }
+			}
+		};
+
+		RemoveOwner(ActorWatchers);
+		RemoveOwner(TagWatchers);
+
+		bBecameEmpty = !HasWatchersUnsafe();
+	}
+
+	if (bBecameEmpty) { RequestActorEventsUpdate(); }
+}
+
+void UPCGExSubSystem::NotifyComponentChanged(const UPCGComponent* InComponent)
+{
+	if (!InComponent) { return; }
+	if (AActor* Owner = InComponent->GetOwner()) { DispatchActorEvent(Owner, InComponent); }
+}
+
+void UPCGExSubSystem::RequestActorEventsUpdate()
+{
+	// Binding right away doesn't miss actors added later this frame; unbinding is always deferred since
+	// this may run from within one of the engine delegates being removed.
+	if (IsInGameThread() && !OnActorSpawnedHandle.IsValid())
+	{
+		UpdateActorEvents();
+		return;
+	}
+
+	AsyncTask(ENamedThreads::GameThread, [WeakThis = TWeakObjectPtr<UPCGExSubSystem>(this)]()
+	{
+		if (UPCGExSubSystem* This = WeakThis.Get()) { This->UpdateActorEvents(); }
+	});
+}
+
+void UPCGExSubSystem::UpdateActorEvents()
+{
+	check(IsInGameThread())
+
+	bool bHasWatchers = false;
+
+	{
+		FReadScopeLock ReadScopeLock(ActorWatchLock);
+		bHasWatchers = HasWatchersUnsafe();
+	}
+
+	if (bHasWatchers) { BindActorEvents(); }
+	else { UnbindActorEvents(); }
+}
+
+void UPCGExSubSystem::BindActorEvents()
+{
+	check(IsInGameThread())
+
+	UWorld* World = GetWorld();
+	if (!World || OnActorSpawnedHandle.IsValid()) { return; }
+
+	OnActorSpawnedHandle = World->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateUObject(this, &UPCGExSubSystem::OnActorAdded));
+	OnLevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &UPCGExSubSystem::OnLevelAdded);
+	OnLoadedActorsAddedHandle = ULevel::OnLoadedActorAddedToLevelPostEvent.AddUObject(this, &UPCGExSubSystem::OnLoadedActorsAdded);
+}
+
+void UPCGExSubSystem::UnbindActorEvents()
+{
+	if (!OnActorSpawnedHandle.IsValid()) { return; }
+
+	if (UWorld* World = GetWorld()) { World->RemoveOnActorSpawnedHandler(OnActorSpawnedHandle); }
+	FWorldDelegates::LevelAddedToWorld.Remove(OnLevelAddedHandle);
+	ULevel::OnLoadedActorAddedToLevelPostEvent.Remove(OnLoadedActorsAddedHandle);
+
+	OnActorSpawnedHandle.Reset();
+	OnLevelAddedHandle.Reset();
+	OnLoadedActorsAddedHandle.Reset();
+}
+
+void UPCGExSubSystem::OnActorAdded(AActor* InActor)
+{
+	DispatchActorEvent(InActor, nullptr);
+}
+
+void UPCGExSubSystem::DispatchActorEvent(AActor* InActor, const UPCGComponent* InComponent)
+{
+	if (!InActor) { return; }
+
+	// Most engine events happen while nobody is watching; keep those off the write lock
+	bool bHasActorWatchers = false;
+	bool bHasTagWatchers = false;
+
+	{
+		FReadScopeLock ReadScopeLock(ActorWatchLock);
+		bHasActorWatchers = !ActorWatchers.IsEmpty();
+		bHasTagWatchers = !TagWatchers.IsEmpty();
+	}
+
+	if (!bHasActorWatchers && !bHasTagWatchers) { return; }
+
+	TArray<FName, TInlineAllocator<8>> Tags;
+	if (bHasTagWatchers)
+	{
+		if (InComponent) { Tags.Append(InComponent->ComponentTags); }
+		else
+		{
+			InActor->ForEachComponent<UPCGComponent>(
+				false, [&Tags](const UPCGComponent* Component)
+				{
+					for (const FName& Tag : Component->ComponentTags) { Tags.AddUnique(Tag); }
+				});
+		}
+	}
+
+	if (!bHasActorWatchers && Tags.IsEmpty()) { return; }
+
+	const FSoftObjectPath ActorPath = bHasActorWatchers ? FSoftObjectPath(InActor) : FSoftObjectPath();
+
+	TArray<FActorWatcher> Watchers;
+	bool bBecameEmpty = false;
+
+	{
+		FWriteScopeLock WriteScopeLock(ActorWatchLock);
+
+		TArray<FActorWatcher> Found;
+		if (bHasActorWatchers && ActorWatchers.RemoveAndCopyValue(ActorPath, Found)) { Watchers.Append(MoveTemp(Found)); }
+		for (const FName& Tag : Tags) { if (TagWatchers.RemoveAndCopyValue(Tag, Found)) { Watchers.Append(MoveTemp(Found)); } }
+
+		if (Watchers.IsEmpty()) { return; }
+		bBecameEmpty = !HasWatchersUnsafe();
+	}
+
+	// Executed outside the lock so callbacks can watch again
+	for (FActorWatcher& Watcher : Watchers) { Watcher.Callback(InActor); }
+
+	if (bBecameEmpty) { RequestActorEventsUpdate(); }
+}
+
+void UPCGExSubSystem::OnLevelAdded(ULevel* InLevel, UWorld* InWorld)
+{
+	if (!InLevel || InWorld != GetWorld()) { return; }
+
+	{
+		FReadScopeLock ReadScopeLock(ActorWatchLock);
+		if (!HasWatchersUnsafe()) { return; }
+	}
+
+	for (AActor* Actor : InLevel->Actors) { OnActorAdded(Actor); }
+}
+
+void UPCGExSubSystem::OnLoadedActorsAdded(const TArray<AActor*>& InActors)
+{
+	const UWorld* World = GetWorld();
+	for (AActor* Actor : InActors) { if (Actor && Actor->GetWorld() == World) { OnActorAdded(Actor); } }
+}
+
+#pragma endregion
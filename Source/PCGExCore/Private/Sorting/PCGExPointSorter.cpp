@@ -10,6 +10,7 @@
 #include "Data/PCGExProxyData.h"
 #include "Data/PCGExProxyDataHelpers.h"
 #include "Sorting/PCGExSortingDetails.h"
+#include "Sorting/PCGExSortingHelpers.h"
 
 namespace PCGExSorting
 {
@@ -373,6 +374,7 @@ namespace PCGExSorting
 
 			RuleCache.Tolerance = Handler->Tolerance;
 			RuleCache.bInvertRule = Handler->bInvertRule;
+			RuleCache.bConstant = Handler->bUseDataTag || !Handler->Buffer;
 			RuleCache.Values.SetNumUninitialized(InNumElements);
 
 			UseTagFlags[RuleIdx] = Handler->bUseDataTag;
@@ -425,5 +427,84 @@ namespace PCGExSorting
 		return Cache;
 	}
 
+	namespace
+	{
+		// Maps a double onto an unsigned key with the same ordering; -0.0 is folded into +0.0
+		FORCEINLINE uint64 OrderedKey(const double InValue, const bool bFlip)
+		{
+			constexpr uint64 SignBit = 1ULL << 63;
+
+			const double Value = InValue + 0.0;
+			uint64 Bits;
+			FMemory::Memcpy(&Bits, &Value, sizeof(uint64));
+
+			Bits = (Bits & SignBit) ? ~Bits : (Bits | SignBit);
+			return bFlip ? ~Bits : Bits;
+		}
+	}
+
+	void FSortCache::RadixSort(TArray<int32>& InOutOrder) const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FSortCache::RadixSort);
+
+		const int32 N = InOutOrder.Num();
+
+		TArray<PCGEx::FIndexKey> Keys;
+		Keys.SetNumUninitialized(N);
+
+		// LSD over rules : each stable pass keeps the order established by the less significant rules
+		for (int32 RuleIdx = CachedNumRules - 1; RuleIdx >= 0; RuleIdx--)
+		{
+			const FRuleCache& Rule = Rules[RuleIdx];
+			if (Rule.bConstant) { continue; }
+
+			const bool bFlip = Rule.bInvertRule != bDescending;
+			const double* Values = Rule.Values.GetData();
+
+			// Values are bucketed by tolerance; a bucket is narrower than the tolerance, so its members
+			// compare as equal and defer to the next rule. Flooring is monotonic, so the key order holds.
+			if (Rule.Tolerance > 0)
+			{
+				const double InvTolerance = 1.0 / Rule.Tolerance;
+				PCGEX_PARALLEL_FOR(
+					N,
+					const int32 Index = InOutOrder[i];
+					Keys[i] = PCGEx::FIndexKey(Index, OrderedKey(FMath::FloorToDouble(Values[Index] * InvTolerance), bFlip));
+				)
+			}
+			else
+			{
+				PCGEX_PARALLEL_FOR(
+					N,
+					const int32 Index = InOutOrder[i];
+					Keys[i] = PCGEx::FIndexKey(Index, OrderedKey(Values[Index], bFlip));
+				)
+			}
+
+			PCGExSortingHelpers::ParallelRadixSort(Keys);
+
+			PCGEX_PARALLEL_FOR(
+				N,
+				InOutOrder[i] = Keys[i].Index;
+			)
+		}
+	}
+
+	void FSortCache::Sort(TArray<int32>& InOutOrder) const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FSortCache::Sort);
+
+		const int32 N = InOutOrder.Num();
+		if (N <= 1) { return; }
+
+		if (N >= 4096)
+		{
+			RadixSort(InOutOrder);
+			return;
+		}
+
+		PCGExSortingHelpers::ParallelMergeSort(InOutOrder, [this](const int32 A, const int32 B) { return Compare(A, B); });
+	}
+
 #pragma endregion
 }
@@ -116,14 +116,14 @@ namespace PCGExCompare
 	{
 		if (bStrict)
 		{
-			for (const TPair<FString, TSharedPtr<PCGExData::IDataValue>>& Pair : InTags->ValueTags)
+			for (const PCGExData::FValueTag& ValueTag : InTags->GetValueTags_Unsafe())
 			{
-				if (Compare(MatchMode, Pair.Key, Query)) { return true; }
+				if (Compare(MatchMode, PCGExData::FTagTable::ToString(ValueTag.Key), Query)) { return true; }
 			}
 
-			for (const FString& Tag : InTags->RawTags)
+			for (const PCGExData::FTagId& Tag : InTags->GetRawTags_Unsafe())
 			{
-				if (Compare(MatchMode, Tag, Query)) { return true; }
+				if (Compare(MatchMode, PCGExData::FTagTable::ToString(Tag), Query)) { return true; }
 			}
 		}
 		else
@@ -140,9 +140,9 @@ namespace PCGExCompare
 
 	bool GetMatchingValueTags(const TSharedPtr<PCGExData::FTags>& InTags, const FString& Query, const EPCGExStringMatchMode MatchMode, TArray<TSharedPtr<PCGExData::IDataValue>>& OutValues)
 	{
-		for (const TPair<FString, TSharedPtr<PCGExData::IDataValue>>& Pair : InTags->ValueTags)
+		for (const PCGExData::FValueTag& ValueTag : InTags->GetValueTags_Unsafe())
 		{
-			if (Compare(MatchMode, Pair.Key, Query)) { OutValues.Add(Pair.Value); }
+			if (Compare(MatchMode, PCGExData::FTagTable::ToString(ValueTag.Key), Query)) { OutValues.Add(ValueTag.Value.ToDataValue()); }
 		}
 
 		return !OutValues.IsEmpty();
@@ -0,0 +1,50 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PCGExClusters
+{
+	class FCluster;
+}
+
+namespace PCGExClusters::SpanningForest
+{
+	/**
+	 * Lock-free union-find over a fixed index range.
+	 * Unions always link the larger root under the smaller one, so the final roots do not depend on thread scheduling.
+	 */
+	class PCGEXCORE_API FConcurrentUnionFind
+	{
+	protected:
+		TArray<int32> Parent;
+
+	public:
+		explicit FConcurrentUnionFind(const int32 InNum);
+
+		FORCEINLINE int32 Num() const { return Parent.Num(); }
+
+		/** Returns the root of Index, halving the path along the way. Thread-safe. */
+		int32 Find(int32 Index);
+
+		/** Merge the sets of A and B. Returns true if this call merged them, false if they already shared a root. Thread-safe. */
+		bool Unite(int32 A, int32 B);
+	};
+
+	/**
+	 * Parallel Borůvka minimum spanning forest.
+	 * Edges are ranked by (weight, index), a strict total order, so the forest is the unique one for that order.
+	 * Weights are per-edge and undirected; callers whose costs depend on direction or traversal order will get a different forest.
+	 * @param NumNodes Number of nodes
+	 * @param Endpoints Per-edge node pair, packed with PCGEx::H64(A, B)
+	 * @param Weights Per-edge weight
+	 * @param OutInForest Per-edge flag, 1 if the edge belongs to the forest
+	 * @return Number of edges in the forest
+	 */
+	PCGEXCORE_API int32 Boruvka(const int32 NumNodes, const TArray<uint64>& Endpoints, const TArray<double>& Weights, TArray<int8>& OutInForest);
+
+	/** Borůvka over a cluster's edges, Weights being indexed like the cluster edges. */
+	PCGEXCORE_API int32 Boruvka(const FCluster* InCluster, const TArray<double>& Weights, TArray<int8>& OutInForest);
+}
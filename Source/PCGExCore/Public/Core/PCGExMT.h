@@ -34,6 +34,14 @@ namespace PCGExMT
 	PCGEXCORE_API
 	int32 SubLoopScopes(TArray<FScope>& OutSubRanges, const int32 NumIterations, const int32 RangeSize);
 
+	/**
+	 * Groups work items by cost so cheap ones share a task instead of paying for one each.
+	 * Items costing InSmallCost or more get a unit of their own; the others are packed, in order, into units sized
+	 * for a few units per core. OutOrder lists item indices unit after unit, and each OutUnits scope is a range of OutOrder.
+	 */
+	PCGEXCORE_API
+	int32 CoalesceWorkUnits(const TArray<int32>& InCosts, const int32 InSmallCost, TArray<int32>& OutOrder, TArray<FScope>& OutUnits);
+
 	enum class EAsyncHandleState : uint8
 	{
 		Idle    = 0,
@@ -133,6 +133,14 @@ namespace PCGExData
 		virtual bool EnsureReadable() = 0;
 		virtual void Write(const bool bEnsureValidKeys = true) = 0;
 
+		/** Prepares a range-split write. Returns false if the buffer can only be written in one go through Write. */
+		virtual bool BeginRangeWrite() { return false; }
+
+		/** Commits a range of the output values. Only valid once BeginRangeWrite succeeded and output keys are valid. */
+		virtual void WriteRange(const PCGExMT::FScope& Scope)
+		{
+		}
+
 		virtual void Fetch(const PCGExMT::FScope& Scope)
 		{
 		}
@@ -293,6 +301,9 @@ extern template bool IBuffer::IsA<_TYPE>() const;
 		virtual bool InitForWrite(const EBufferInit Init = EBufferInit::Inherit) override;
 		virtual void Write(const bool bEnsureValidKeys = true) override;
 
+		virtual bool BeginRangeWrite() override;
+		virtual void WriteRange(const PCGExMT::FScope& Scope) override;
+
 		virtual void Fetch(const PCGExMT::FScope& Scope) override;
 
 		virtual void Flush() override;
@@ -32,14 +32,141 @@ namespace PCGExData
 {
 	const FString TagSeparator = TEXT(":");
 
+	/**
+	 * Handle to an interned tag string.
+	 * Index identifies the exact spelling; Key is shared by every spelling that only differs by case,
+	 * so handles compare like FString does while flattening gives back the original string.
+	 */
+	struct PCGEXCORE_API FTagId
+	{
+		uint32 Index = MAX_uint32;
+		uint32 Key = MAX_uint32;
+
+		FTagId() = default;
+
+		FTagId(const uint32 InIndex, const uint32 InKey)
+			: Index(InIndex), Key(InKey)
+		{
+		}
+
+		FORCEINLINE bool IsValid() const { return Key != MAX_uint32; }
+		FORCEINLINE bool operator==(const FTagId& Other) const { return Key == Other.Key; }
+		FORCEINLINE bool operator!=(const FTagId& Other) const { return Key != Other.Key; }
+		FORCEINLINE friend uint32 GetTypeHash(const FTagId& Id) { return Id.Key; }
+	};
+
+	/** Process-wide, thread-safe table of tag strings, FName-like. Entries are never freed. */
+	class PCGEXCORE_API FTagTable
+	{
+	public:
+		/** Returns the handle of that exact spelling, adding it if needed. */
+		static FTagId Intern(const FString& InString);
+
+		/** Returns a handle comparing equal to that string, or an invalid one if no such tag was ever interned. Never adds. */
+		static FTagId Find(const FString& InString);
+
+		static const FString& ToString(const FTagId& InId);
+	};
+
+	/**
+	 * Tag value stored inline by type. Text and text-like types are interned;
+	 * FTransform, the only type too large to fit, is boxed and never mutated once stored.
+	 * Mirrors TDataValue semantics (IsNumeric, AsDouble, Flatten...) without a heap allocation per value.
+	 */
+	struct PCGEXCORE_API FTagValue
+	{
+		EPCGMetadataTypes Type = EPCGMetadataTypes::Unknown;
+		FTagId Text;
+		TSharedPtr<IDataValue> Boxed;
+
+		union
+		{
+			int64 Integer;
+			double Real[4];
+		};
+
+		FTagValue() { Real[0] = Real[1] = Real[2] = Real[3] = 0; }
+
+		template <typename T>
+		static FTagValue Make(const T& InValue)
+		{
+			FTagValue Out;
+			Out.Type = PCGExTypes::TTraits<T>::Type;
+
+			if constexpr (std::is_same_v<T, bool>) { Out.Integer = InValue ? 1 : 0; }
+			else if constexpr (std::is_integral_v<T>) { Out.Integer = InValue; }
+			else if constexpr (std::is_floating_point_v<T>) { Out.Real[0] = InValue; }
+			else if constexpr (std::is_same_v<T, FVector2D>) { Out.SetReal(InValue.X, InValue.Y); }
+			else if constexpr (std::is_same_v<T, FVector>) { Out.SetReal(InValue.X, InValue.Y, InValue.Z); }
+			else if constexpr (std::is_same_v<T, FVector4> || std::is_same_v<T, FQuat>) { Out.SetReal(InValue.X, InValue.Y, InValue.Z, InValue.W); }
+			else if constexpr (std::is_same_v<T, FRotator>) { Out.SetReal(InValue.Pitch, InValue.Yaw, InValue.Roll); }
+			else if constexpr (std::is_same_v<T, FString>) { Out.Text = FTagTable::Intern(InValue); }
+			else if constexpr (std::is_same_v<T, FTransform>) { Out.Boxed = MakeShared<TDataValue<T>>(InValue); }
+			else { Out.Text = FTagTable::Intern(InValue.ToString()); }
+
+			return Out;
+		}
+
+		/** Typed read. Only valid when Type matches T. */
+		template <typename T>
+		T Get() const
+		{
+			if constexpr (std::is_same_v<T, bool>) { return Integer != 0; }
+			else if constexpr (std::is_integral_v<T>) { return static_cast<T>(Integer); }
+			else if constexpr (std::is_floating_point_v<T>) { return static_cast<T>(Real[0]); }
+			else if constexpr (std::is_same_v<T, FVector2D>) { return FVector2D(Real[0], Real[1]); }
+			else if constexpr (std::is_same_v<T, FVector>) { return FVector(Real[0], Real[1], Real[2]); }
+			else if constexpr (std::is_same_v<T, FVector4>) { return FVector4(Real[0], Real[1], Real[2], Real[3]); }
+			else if constexpr (std::is_same_v<T, FQuat>) { return FQuat(Real[0], Real[1], Real[2], Real[3]); }
+			else if constexpr (std::is_same_v<T, FRotator>) { return FRotator(Real[0], Real[1], Real[2]); }
+			else if constexpr (std::is_same_v<T, FString>) { return FTagTable::ToString(Text); }
+			else if constexpr (std::is_same_v<T, FName>) { return FName(FTagTable::ToString(Text)); }
+			else if constexpr (std::is_same_v<T, FTransform>) { return StaticCastSharedPtr<TDataValue<T>>(Boxed)->Value; }
+			else { return T(FTagTable::ToString(Text)); }
+		}
+
+		bool IsNumeric() const;
+		bool IsText() const;
+
+		double AsDouble() const;
+		FString AsString() const;
+
+		bool SameValue(const FTagValue& Other) const;
+
+		FString Flatten(const FString& LeftSide) const;
+
+		/** Standalone copy, for callers of the IDataValue API */
+		TSharedPtr<IDataValue> ToDataValue() const;
+
+		/** Parses the right side of a NAME:VALUE tag; numeric, then vectors, then bool, then string. */
+		static FTagValue Parse(const FString& InValue);
+
+	protected:
+		FORCEINLINE void SetReal(const double X, const double Y, const double Z = 0, const double W = 0)
+		{
+			Real[0] = X;
+			Real[1] = Y;
+			Real[2] = Z;
+			Real[3] = W;
+		}
+	};
+
+	struct FValueTag
+	{
+		FTagId Key;
+		FTagValue Value;
+	};
+
 	class PCGEXCORE_API FTags : public TSharedFromThis<FTags>
 	{
 		mutable FRWLock TagsLock;
 
-	public:
-		TSet<FString> RawTags;                           // Contains all data tag
-		TMap<FString, TSharedPtr<IDataValue>> ValueTags; // Prefix:ValueTag
+	protected:
+		// Small inline sets; tags are few per data so a linear scan over interned handles beats hashing strings
+		TArray<FTagId, TInlineAllocator<8>> RawTags;       // Contains all data tag
+		TArray<FValueTag, TInlineAllocator<2>> ValueTags; // Prefix:ValueTag
 
+	public:
 		int32 Num() const;
 		bool IsEmpty() const;
 
@@ -70,34 +197,36 @@ namespace PCGExData
 		template <typename T>
 		TSharedPtr<TDataValue<T>> GetOrSet(const FString& Key, const T& Value)
 		{
+			const FTagId Id = FTagTable::Intern(Key);
+
 			{
 				FReadScopeLock ReadScopeLock(TagsLock);
 
-				TArray<T> ValuesForKey;
-				if (const TSharedPtr<IDataValue>* ValueTagPtr = ValueTags.Find(Key))
+				if (const FTagValue* Existing = FindValue_Unsafe(Id))
 				{
-					if ((*ValueTagPtr)->GetTypeId() == PCGExTypes::TTraits<T>::Type)
-					{
-						return StaticCastSharedPtr<TDataValue<T>>(*ValueTagPtr);
-					}
+					if (Existing->Type == PCGExTypes::TTraits<T>::Type) { return MakeShared<TDataValue<T>>(Existing->Get<T>()); }
 				}
 			}
 
 			{
 				FWriteScopeLock WriteScopeLock(TagsLock);
-
-				const TSharedPtr<TDataValue<T>> ValueTag = MakeShared<TDataValue<T>>(Value);
-				ValueTags.Add(Key, ValueTag);
-				return ValueTag;
+				SetValue_Unsafe(Id, FTagValue::Make<T>(Value));
 			}
+
+			return MakeShared<TDataValue<T>>(Value);
 		}
 
 		template <typename T>
 		TSharedPtr<TDataValue<T>> Set(const FString& Key, const T& Value)
 		{
-			const TSharedPtr<TDataValue<T>> ValueTag = GetOrSet(Key, Value);
-			ValueTag->Value = Value;
-			return ValueTag;
+			const FTagId Id = FTagTable::Intern(Key);
+
+			{
+				FWriteScopeLock WriteScopeLock(TagsLock);
+				SetValue_Unsafe(Id, FTagValue::Make<T>(Value));
+			}
+
+			return MakeShared<TDataValue<T>>(Value);
 		}
 
 		template <typename T>
@@ -113,14 +242,14 @@ namespace PCGExData
 		template <typename T>
 		TSharedPtr<TDataValue<T>> GetTypedValue(const FString& Key) const
 		{
+			const FTagId Id = FTagTable::Find(Key);
+			if (!Id.IsValid()) { return nullptr; }
+
 			FReadScopeLock ReadScopeLock(TagsLock);
 
-			if (const TSharedPtr<IDataValue>* ValueTagPtr = ValueTags.Find(Key))
+			if (const FTagValue* Value = FindValue_Unsafe(Id))
 			{
-				if ((*ValueTagPtr)->GetTypeId() == PCGExTypes::TTraits<T>::Type)
-				{
-					return StaticCastSharedPtr<TDataValue<T>>(*ValueTagPtr);
-				}
+				if (Value->Type == PCGExTypes::TTraits<T>::Type) { return MakeShared<TDataValue<T>>(Value->Get<T>()); }
 			}
 
 			return nullptr;
@@ -138,8 +267,23 @@ namespace PCGExData
 		bool IsTagged(const FString& Key) const;
 		bool IsTagged(const FString& Key, const bool bInvert) const;
 
+		/** Inline copy of a value tag, without going through IDataValue. */
+		bool TryGetTagValue(const FString& Key, FTagValue& OutValue) const;
+
+		/**
+		 * Direct views over the interned storage, for hot loops that compare tags.
+		 * No locking: only safe while no other thread modifies these tags.
+		 */
+		TConstArrayView<FTagId> GetRawTags_Unsafe() const { return RawTags; }
+		TConstArrayView<FValueTag> GetValueTags_Unsafe() const { return ValueTags; }
+		bool HasRawTag_Unsafe(const FTagId& Id) const { return RawTags.Contains(Id); }
+		const FTagValue* FindValue_Unsafe(const FTagId& Id) const;
+
 	protected:
 		void ParseAndAdd(const FString& InTag);
+		void AddRaw_Unsafe(const FTagId& Id);
+		void SetValue_Unsafe(const FTagId& Id, FTagValue&& InValue);
+		void Remove_Unsafe(const FTagId& Id);
 
 		// NAME:VALUE
 		static bool GetTagFromString(const FString& Input, FString& OutKey, FString& OutValue);
@@ -27,6 +27,9 @@ namespace PCGExData
 
 		virtual FString Flatten(const FString& LeftSide) = 0;
 
+		/** Returns an independent copy holding the same typed value */
+		virtual TSharedPtr<IDataValue> Clone() const = 0;
+
 		virtual bool IsNumeric() const = 0;
 		virtual bool IsText() const = 0;
 
@@ -66,6 +69,8 @@ extern template _TYPE IDataValue::GetValue<_TYPE>();
 
 		virtual FString Flatten(const FString& LeftSide) override;
 
+		virtual TSharedPtr<IDataValue> Clone() const override;
+
 		virtual bool IsNumeric() const override;
 		virtual bool IsText() const override;
 
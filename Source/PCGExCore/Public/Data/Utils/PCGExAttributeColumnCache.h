@@ -0,0 +1,119 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/ScopeRWLock.h"
+#include "UObject/ObjectKey.h"
+
+class UPCGData;
+class FPCGMetadataAttributeBase;
+
+namespace PCGExData
+{
+	/**
+	 * Identity of a decoded attribute column.
+	 * Data & attribute pointers guard against a recycled object or a re-created attribute hitting a stale entry.
+	 */
+	struct PCGEXCORE_API FAttributeColumnKey
+	{
+		FObjectKey Data;
+		const FPCGMetadataAttributeBase* Attribute = nullptr;
+		uint64 UID = 0; // BufferUID(Identifier, Type)
+		int32 Num = 0;
+
+		FAttributeColumnKey() = default;
+		FAttributeColumnKey(const UPCGData* InData, const FPCGMetadataAttributeBase* InAttribute, const uint64 InUID, const int32 InNum);
+
+		FORCEINLINE bool operator==(const FAttributeColumnKey& Other) const
+		{
+			return Data == Other.Data && Attribute == Other.Attribute && UID == Other.UID && Num == Other.Num;
+		}
+
+		friend FORCEINLINE uint32 GetTypeHash(const FAttributeColumnKey& Key)
+		{
+			return HashCombineFast(HashCombineFast(GetTypeHash(Key.Data), GetTypeHash(Key.UID)), GetTypeHash(Key.Num));
+		}
+	};
+
+	/**
+	 * Process-wide cache of fully decoded input attribute columns.
+	 * Nodes chained on the same immutable input data share a single read instead of decoding it again each time.
+	 * Columns are handed out as shared arrays and must be treated as read-only; eviction is least-recently-used under
+	 * the AttributeColumnCacheBudgetMB setting, and only drops the cache's own reference.
+	 * Data that gets written to in place (forwarded outputs, buffer writes) must be invalidated first, see Invalidate.
+	 * Columns are grouped by source data so invalidation only touches that data's columns; columns of data that has
+	 * since been garbage collected are purged whenever a new column is added.
+	 */
+	class PCGEXCORE_API FAttributeColumnCache
+	{
+	public:
+		static FAttributeColumnCache& Get();
+
+		/** Whether the cache is enabled and worth using for a column of that size. */
+		bool CanCache(const int32 InNum) const;
+
+		template <typename T>
+		TSharedPtr<TArray<T>> Find(const FAttributeColumnKey& Key)
+		{
+			// The key embeds the value type, so a hit is always a TColumn<T>
+			const TSharedPtr<IColumn> Column = FindColumn(Key);
+			return Column ? StaticCastSharedPtr<TColumn<T>>(Column)->Values : nullptr;
+		}
+
+		template <typename T>
+		void Add(const FAttributeColumnKey& Key, const TSharedPtr<TArray<T>>& Values)
+		{
+			if (!Values) { return; }
+			AddColumn(Key, MakeShared<TColumn<T>>(Values), Values->Num() * sizeof(T));
+		}
+
+		/** Drops every column decoded from that data. Must be called before it is mutated in place. Free when the cache is empty. */
+		void Invalidate(const UPCGData* InData);
+
+		void Empty();
+
+	private:
+		class IColumn
+		{
+		public:
+			virtual ~IColumn() = default;
+		};
+
+		template <typename T>
+		class TColumn final : public IColumn
+		{
+		public:
+			TSharedPtr<TArray<T>> Values;
+
+			explicit TColumn(const TSharedPtr<TArray<T>>& InValues)
+				: Values(InValues)
+			{
+			}
+		};
+
+		struct FEntry
+		{
+			TSharedPtr<IColumn> Column;
+			int64 Bytes = 0;
+			std::atomic<uint64> LastUse{0};
+		};
+
+		FAttributeColumnCache() = default;
+
+		TSharedPtr<IColumn> FindColumn(const FAttributeColumnKey& Key);
+		void AddColumn(const FAttributeColumnKey& Key, const TSharedPtr<IColumn>& Column, const int64 Bytes);
+		void PurgeUnsafe();
+		void EvictUnsafe(const int64 Budget);
+		void RemoveDataUnsafe(const FObjectKey& DataKey);
+
+		using FDataColumns = TMap<FAttributeColumnKey, TSharedPtr<FEntry>>;
+
+		TMap<FObjectKey, FDataColumns> Entries; // Source data -> its decoded columns
+		std::atomic<int32> NumData{0};          // Entries.Num(), readable without the lock
+		int64 TotalBytes = 0;
+		std::atomic<uint64> UseCounter{0};
+		mutable FRWLock Lock;
+	};
+}
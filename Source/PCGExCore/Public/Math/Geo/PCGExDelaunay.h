@@ -33,12 +33,18 @@ namespace PCGExMath::Geo
 		FORCEINLINE uint64 AC() const { return PCGEx::H64U(Vtx[0], Vtx[2]); }
 	};
 
+	/**
+	 * Order positions along a 3D Hilbert curve, so consecutive insertions stay spatially close.
+	 * OutOrder[i] is the index of the i-th position along the curve.
+	 */
+	PCGEXCORE_API void HilbertOrder(const TArrayView<const FVector>& Positions, TArray<int32>& OutOrder);
+
 	class PCGEXCORE_API TDelaunay2
 	{
 	public:
 		TArray<FDelaunaySite2> Sites;
 
-		TSet<uint64> DelaunayEdges;
+		TArray<uint64> DelaunayEdges; // Sorted & unique
 		TSet<int32> DelaunayHull;
 		bool IsValid = false;
 
@@ -49,6 +55,7 @@ namespace PCGExMath::Geo
 
 	protected:
 		void Clear();
+		void BuildEdges();
 
 	public:
 		bool Process(const TArrayView<FVector>& Positions, const FPCGExGeo2DProjectionDetails& ProjectionDetails);
@@ -76,9 +83,9 @@ namespace PCGExMath::Geo
 	public:
 		TArray<FDelaunaySite3> Sites;
 
-		TSet<uint64> DelaunayEdges;
+		TArray<uint64> DelaunayEdges; // Sorted & unique
 		TSet<int32> DelaunayHull;
-		TMap<uint32, uint64> Adjacency;
+		TArray<uint64> Adjacency; // One NH64(SiteA, SiteB) per face, -1 on the open side of hull faces
 
 		bool IsValid = false;
 
@@ -91,6 +98,10 @@ namespace PCGExMath::Geo
 	protected:
 		void Clear();
 
+		bool Triangulate(const TArrayView<FVector>& Positions, TArray<FIntVector4>& OutTetrahedra) const;
+		void BuildSites(const TArray<FIntVector4>& Tetrahedra, const bool bComputeFaces);
+		void BuildFaces(const bool bComputeAdjacency, const bool bComputeHull);
+
 	public:
 		template <bool bComputeAdjacency = false, bool bComputeHull = false>
 		bool Process(const TArrayView<FVector>& Positions)
@@ -98,9 +109,8 @@ namespace PCGExMath::Geo
 			Clear();
 			if (Positions.IsEmpty() || Positions.Num() <= 3) { return false; }
 
-			UE::Geometry::FDelaunay3 Tetrahedralization;
-
-			if (!Tetrahedralization.Triangulate(Positions))
+			TArray<FIntVector4> Tetrahedra;
+			if (!Triangulate(Positions, Tetrahedra))
 			{
 				Clear();
 				return false;
@@ -108,88 +118,11 @@ namespace PCGExMath::Geo
 
 			IsValid = true;
 
-			TArray<FIntVector4> Tetrahedra = Tetrahedralization.GetTetrahedra();
-
-			const int32 NumSites = Tetrahedra.Num();
-			const int32 NumReserve = NumSites * 3;
-
-			DelaunayEdges.Reserve(NumReserve);
-
-			TSet<uint32> FacesUsage;
-			if constexpr (bComputeAdjacency) { Adjacency.Reserve(NumSites * 4); }
-			if constexpr (bComputeHull) { FacesUsage.Reserve(NumSites); }
-
-			//PCGExArrayHelpers::InitArray(Sites, NumSites);
-			Sites.SetNumUninitialized(NumSites);
-
-			for (int i = 0; i < NumSites; i++)
-			{
-				Sites[i] = FDelaunaySite3(Tetrahedra[i], i);
-				FDelaunaySite3& Site = Sites[i];
-
-				for (int a = 0; a < 4; a++)
-				{
-					for (int b = a + 1; b < 4; b++)
-					{
-						DelaunayEdges.Add(PCGEx::H64U(Site.Vtx[a], Site.Vtx[b]));
-					}
-				}
-
-				if constexpr (bComputeHull || bComputeAdjacency) { Site.ComputeFaces(); }
-
-				if constexpr (bComputeHull && bComputeAdjacency)
-				{
-					for (int f = 0; f < 4; f++)
-					{
-						const uint32 FH = Site.Faces[f];
-
-						bool bAlreadySet = false;
-						FacesUsage.Add(FH, &bAlreadySet);
-						if (bAlreadySet) { FacesUsage.Remove(FH); }
-
-						if (const uint64* AH = Adjacency.Find(FH)) { Adjacency.Add(FH, PCGEx::NH64(i, PCGEx::NH64B(*AH))); }
-						else { Adjacency.Add(FH, PCGEx::NH64(-1, i)); }
-					}
-				}
-				else if constexpr (bComputeHull)
-				{
-					for (int f = 0; f < 4; f++)
-					{
-						const uint32 FH = Site.Faces[f];
-						bool bAlreadySet = false;
-						FacesUsage.Add(FH, &bAlreadySet);
-						if (bAlreadySet) { FacesUsage.Remove(FH); }
-					}
-				}
-				else if constexpr (bComputeAdjacency)
-				{
-					for (int f = 0; f < 4; f++)
-					{
-						const uint32 FH = Site.Faces[f];
-						if (const uint64* AH = Adjacency.Find(FH)) { Adjacency.Add(FH, PCGEx::NH64(i, PCGEx::NH64B(*AH))); }
-						else { Adjacency.Add(FH, PCGEx::NH64(-1, i)); }
-					}
-				}
-			}
-
-			if constexpr (bComputeHull)
-			{
-				for (FDelaunaySite3& Site : Sites)
-				{
-					for (int f = 0; f < 4; f++)
-					{
-						if (FacesUsage.Contains(Site.Faces[f]))
-						{
-							for (int fi = 0; fi < 3; fi++) { DelaunayHull.Add(Site.Vtx[MTX[f][fi]]); }
-							Site.bOnHull = true;
-						}
-					}
-				}
-			}
-
-			FacesUsage.Empty();
+			BuildSites(Tetrahedra, bComputeAdjacency || bComputeHull);
 			Tetrahedra.Empty();
 
+			if constexpr (bComputeAdjacency || bComputeHull) { BuildFaces(bComputeAdjacency, bComputeHull); }
+
 			return IsValid;
 		}
 
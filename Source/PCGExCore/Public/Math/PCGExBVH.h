@@ -0,0 +1,146 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PCGExBVH
+{
+	struct PCGEXCORE_API FItem
+	{
+		FBox Bounds = FBox(ForceInit);
+		int32 Index = -1;
+
+		FItem() = default;
+
+		FItem(const FBox& InBounds, const int32 InIndex)
+			: Bounds(InBounds), Index(InIndex)
+		{
+		}
+	};
+
+	struct PCGEXCORE_API FNode
+	{
+		FBox Bounds = FBox(ForceInit);
+		int32 Left = -1;  // Child node, or first item if leaf
+		int32 Right = -1; // Child node, or -1
+		int32 Count = 0;  // Item count if leaf, 0 otherwise
+
+		FORCEINLINE bool IsLeaf() const { return Count > 0; }
+	};
+
+	/**
+	 * Flat, immutable bounding volume hierarchy.
+	 * Items are sorted along a Morton curve, packed into fixed-size leaves, and the tree is built bottom-up one level at a time.
+	 * Every step of the build runs in parallel; queries are read-only and thread-safe.
+	 */
+	class PCGEXCORE_API FBVH : public TSharedFromThis<FBVH>
+	{
+	protected:
+		TArray<FNode> Nodes;
+		TArray<FBox> ItemBounds;
+		TArray<int32> ItemIndices;
+		int32 Root = -1;
+
+	public:
+		FBVH() = default;
+
+		/** Build the hierarchy. Item.Index is the payload handed back by queries. */
+		void Build(TArray<FItem>&& InItems, const int32 InLeafSize = 4);
+
+		FORCEINLINE bool IsEmpty() const { return Root == -1; }
+		FORCEINLINE int32 Num() const { return ItemIndices.Num(); }
+		FORCEINLINE FBox GetBounds() const { return Root == -1 ? FBox(ForceInit) : Nodes[Root].Bounds; }
+
+		/** Invoke Callback(Index) for every item whose bounds intersect the query box. */
+		template <typename FCallback>
+		void FindElementsWithBoundsTest(const FBox& InQuery, FCallback&& Callback) const
+		{
+			if (Root == -1) { return; }
+
+			TArray<int32, TInlineAllocator<64>> Stack;
+			Stack.Add(Root);
+
+			while (!Stack.IsEmpty())
+			{
+				const FNode& Node = Nodes[Stack.Pop(EAllowShrinking::No)];
+				if (!Node.Bounds.Intersect(InQuery)) { continue; }
+
+				if (Node.IsLeaf())
+				{
+					const int32 End = Node.Left + Node.Count;
+					for (int32 i = Node.Left; i < End; i++) { if (ItemBounds[i].Intersect(InQuery)) { Callback(ItemIndices[i]); } }
+					continue;
+				}
+
+				Stack.Add(Node.Left);
+				if (Node.Right != -1) { Stack.Add(Node.Right); }
+			}
+		}
+
+		/**
+		 * Branch-and-bound nearest search.
+		 * DistSquared(Index) returns the exact squared distance to an item; nodes farther than the current best are pruned.
+		 * Returns the payload of the closest item within InMaxDistSquared, or -1.
+		 */
+		template <typename FDistSquared>
+		int32 FindNearest(const FVector& InPosition, FDistSquared&& DistSquared, double& OutDistSquared, const double InMaxDistSquared = MAX_dbl) const
+		{
+			OutDistSquared = InMaxDistSquared;
+			if (Root == -1) { return -1; }
+
+			int32 Best = -1;
+
+			TArray<int32, TInlineAllocator<64>> Stack;
+			Stack.Add(Root);
+
+			while (!Stack.IsEmpty())
+			{
+				const FNode& Node = Nodes[Stack.Pop(EAllowShrinking::No)];
+				if (Node.Bounds.ComputeSquaredDistanceToPoint(InPosition) > OutDistSquared) { continue; }
+
+				if (Node.IsLeaf())
+				{
+					const int32 End = Node.Left + Node.Count;
+					for (int32 i = Node.Left; i < End; i++)
+					{
+						if (ItemBounds[i].ComputeSquaredDistanceToPoint(InPosition) > OutDistSquared) { continue; }
+						const double D = DistSquared(ItemIndices[i]);
+						if (D < OutDistSquared)
+						{
+							OutDistSquared = D;
+							Best = ItemIndices[i];
+						}
+					}
+					continue;
+				}
+
+				if (Node.Right == -1)
+				{
+					Stack.Add(Node.Left);
+					continue;
+				}
+
+				// Push the farther child first so the closer one is visited next and tightens the bound early
+				const double DL = Nodes[Node.Left].Bounds.ComputeSquaredDistanceToPoint(InPosition);
+				const double DR = Nodes[Node.Right].Bounds.ComputeSquaredDistanceToPoint(InPosition);
+				if (DL < DR)
+				{
+					Stack.Add(Node.Right);
+					Stack.Add(Node.Left);
+				}
+				else
+				{
+					Stack.Add(Node.Left);
+					Stack.Add(Node.Right);
+				}
+			}
+
+			return Best;
+		}
+
+		/** Returns true if any item bounds intersect the query box. */
+		bool HasElementsWithBoundsTest(const FBox& InQuery) const;
+	};
+}
@@ -32,6 +32,7 @@ struct PCGEXCORE_API FPCGExCoreSettingsCache
 	bool bDefaultScopedAttributeGet = true;
 	bool bBulkInitData = false;
 	bool bUseDelaunator = true;
+	bool bDelaunayHilbertSort = false;
 	bool bAssertOnEmptyThread = true;
 
 	bool bUseNativeColorsIfPossible = true;
@@ -47,6 +48,8 @@ struct PCGEXCORE_API FPCGExCoreSettingsCache
 
 	int32 SmallClusterSize = 512;
 
+	int32 AttributeColumnCacheBudgetMB = 256;
+
 	int32 PointsDefaultBatchChunkSize = 1024;
 	int32 GetPointsBatchChunkSize(const int32 In = -1) const { return FMath::Max(In <= -1 ? PointsDefaultBatchChunkSize : In, 1); }
 
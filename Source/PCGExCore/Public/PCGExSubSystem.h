@@ -10,6 +10,8 @@
 
 #define PCGEX_SUBSYSTEM UPCGExSubSystem* PCGExSubsystem = UPCGExSubSystem::GetSubsystemForCurrentWorld(); check(PCGExSubsystem)
 
+class AActor;
+class ULevel;
 class UPCGComponent;
 class UPCGExConstantFilterFactory;
 
@@ -90,6 +92,61 @@ public:
 
 	void PollEvent(UPCGComponent* InSource, EPCGExSubsystemEventType InEventType, uint32 InEventId);
 
+#pragma region Actor watch
+
+	using FOnActorEvent = TFunction<void(AActor*)>;
+
+	/**
+	 * One-shot subscription keyed by actor path. Callback fires on the game thread the next time that actor
+	 * is added to the world (spawned, streamed in or loaded), or one of its PCG components is reported through NotifyComponentChanged.
+	 * Lets waiters sleep until something relevant happens instead of rescanning every tick.
+	 * InOwner is an opaque tag used to drop the subscriptions through UnwatchActors.
+	 */
+	void WatchActor(const FSoftObjectPath& InActorPath, const void* InOwner, FOnActorEvent&& Callback);
+
+	/**
+	 * One-shot subscription keyed by component tag. Callback fires on the game thread with the owning actor the next time
+	 * a PCG component carrying that tag is added to the world or reported through NotifyComponentChanged.
+	 * Lets a waiter hold a single subscription instead of one per actor.
+	 */
+	void WatchComponentTag(const FName InTag, const void* InOwner, FOnActorEvent&& Callback);
+
+	/** Drops every pending subscription made by that owner, by path or by tag. Must be called once the owner stops waiting. */
+	void UnwatchActors(const void* InOwner);
+
+	/** Wakes watchers of the component's owner and of its tags, e.g. once a component has finished generating. */
+	void NotifyComponentChanged(const UPCGComponent* InComponent);
+
+protected:
+	struct FActorWatcher
+	{
+		const void* Owner = nullptr;
+		FOnActorEvent Callback;
+	};
+
+	FRWLock ActorWatchLock;
+	TMap<FSoftObjectPath, TArray<FActorWatcher>> ActorWatchers;
+	TMap<FName, TArray<FActorWatcher>> TagWatchers;
+
+	bool HasWatchersUnsafe() const { return !ActorWatchers.IsEmpty() || !TagWatchers.IsEmpty(); }
+
+	FDelegateHandle OnActorSpawnedHandle;
+	FDelegateHandle OnLevelAddedHandle;
+	FDelegateHandle OnLoadedActorsAddedHandle;
+
+	void RequestActorEventsUpdate();
+	void UpdateActorEvents();
+	void BindActorEvents();
+	void UnbindActorEvents();
+
+	void OnActorAdded(AActor* InActor);
+	void DispatchActorEvent(AActor* InActor, const UPCGComponent* InComponent);
+	void OnLevelAdded(ULevel* InLevel, UWorld* InWorld);
+	void OnLoadedActorsAdded(const TArray<AActor*>& InActors);
+
+public:
+#pragma endregion
+
 #pragma region Indices buffer
 
 protected:
@@ -91,6 +91,9 @@ namespace PCGExSorting
 	 *
 	 * Usage:
 	 *   auto Cache = Sorter->BuildCache(NumPoints);
+	 *   Cache->Sort(Order);
+	 *
+	 * or, for custom sorting:
 	 *   Order.Sort([&](int32 A, int32 B) { return Cache->Compare(A, B); });
 	 */
 	class PCGEXCORE_API FSortCache
@@ -101,6 +104,7 @@ namespace PCGExSorting
 			TArray<double> Values;
 			double Tolerance = DBL_COMPARE_TOLERANCE;
 			bool bInvertRule = false;
+			bool bConstant = false; // Same value for every element (tag-based rules)
 		};
 
 	private:
@@ -109,6 +113,14 @@ namespace PCGExSorting
 		int32 NumElements = 0;
 		int32 CachedNumRules = 0;
 
+		/**
+		 * Order-preserving radix keys, one stable pass per rule from last to first.
+		 * Rules with a tolerance are keyed on floor(Value / Tolerance): values sharing a bucket are within tolerance
+		 * and fall through to the next rule like in Compare, values further apart than the tolerance always keep
+		 * Compare's order. Values within tolerance across a bucket boundary are ordered by value.
+		 */
+		void RadixSort(TArray<int32>& InOutOrder) const;
+
 	public:
 		FSortCache() = default;
 
@@ -121,6 +133,13 @@ namespace PCGExSorting
 		/** Get number of rules */
 		FORCEINLINE int32 NumRules() const { return CachedNumRules; }
 
+		/**
+		 * Sort indices using cached values.
+		 * Large inputs go through a parallel radix sort on tolerance-bucketed keys (see RadixSort),
+		 * smaller ones through a parallel merge sort using Compare.
+		 */
+		void Sort(TArray<int32>& InOutOrder) const;
+
 		/** Fast comparison using cached values. No virtual calls. */
 		FORCEINLINE bool Compare(const int32 A, const int32 B) const
 		{
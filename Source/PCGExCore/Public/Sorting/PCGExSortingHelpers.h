@@ -5,6 +5,8 @@
 
 #include "PCGExH.h"
 #include "CoreMinimal.h"
+#include "Algo/Sort.h"
+#include "Async/ParallelFor.h"
 
 namespace PCGExSortingHelpers
 {
@@ -73,4 +75,148 @@ namespace PCGExSortingHelpers
 			Swap(Curr, Out);
 		}
 	}
+
+	/**
+	 * Stable parallel LSD radix sort, 8 bits per pass over the lowest NumBytes of GetKey(Item).
+	 * Each pass counts digits per chunk in parallel, prefix-sums digit-major so the scatter stays stable, then scatters in parallel.
+	 * Passes where every item shares the same digit are skipped.
+	 */
+	template <typename T, typename FGetKey>
+	static void ParallelRadixSort(TArray<T>& Items, FGetKey&& GetKey, const int32 NumBytes = sizeof(uint64))
+	{
+		const int32 N = Items.Num();
+		if (N <= 1) { return; }
+
+		constexpr int32 NUM_BUCKETS = 256;
+
+		const int32 NumChunks = FMath::Clamp(N / 16384, 1, 64);
+		const int32 ChunkSize = FMath::DivideAndRoundUp(N, NumChunks);
+
+		TArray<T> Temp;
+		Temp.SetNumUninitialized(N);
+
+		T* Curr = Items.GetData();
+		T* Out = Temp.GetData();
+
+		TArray<int32> Counts;
+		Counts.SetNumUninitialized(NumChunks * NUM_BUCKETS);
+
+		for (int32 pass = 0; pass < NumBytes; ++pass)
+		{
+			const int32 Shift = pass * 8;
+
+			ParallelFor(
+				NumChunks, [&](const int32 c)
+				{
+					int32* Count = Counts.GetData() + c * NUM_BUCKETS;
+					FMemory::Memzero(Count, NUM_BUCKETS * sizeof(int32));
+
+					const int32 End = FMath::Min(N, (c + 1) * ChunkSize);
+					for (int32 i = c * ChunkSize; i < End; ++i) { Count[(static_cast<uint64>(GetKey(Curr[i])) >> Shift) & 0xFF]++; }
+				}, NumChunks == 1);
+
+			bool bSingleDigit = false;
+			int32 Sum = 0;
+
+			for (int32 b = 0; b < NUM_BUCKETS; ++b)
+			{
+				const int32 Start = Sum;
+				for (int32 c = 0; c < NumChunks; ++c)
+				{
+					int32& Count = Counts[c * NUM_BUCKETS + b];
+					const int32 V = Count;
+					Count = Sum;
+					Sum += V;
+				}
+
+				if (Sum - Start == N)
+				{
+					bSingleDigit = true;
+					break;
+				}
+			}
+
+			if (bSingleDigit) { continue; }
+
+			ParallelFor(
+				NumChunks, [&](const int32 c)
+				{
+					int32* Offsets = Counts.GetData() + c * NUM_BUCKETS;
+
+					const int32 End = FMath::Min(N, (c + 1) * ChunkSize);
+					for (int32 i = c * ChunkSize; i < End; ++i) { Out[Offsets[(static_cast<uint64>(GetKey(Curr[i])) >> Shift) & 0xFF]++] = Curr[i]; }
+				}, NumChunks == 1);
+
+			Swap(Curr, Out);
+		}
+
+		if (Curr != Items.GetData()) { Items = MoveTemp(Temp); }
+	}
+
+	/**
+	 * Parallel merge sort driven by an arbitrary predicate.
+	 * Chunks are sorted in parallel, then merged pairwise in parallel rounds. Use when items have no radix-friendly key.
+	 */
+	template <typename T, typename FPredicate>
+	static void ParallelMergeSort(TArray<T>& Items, FPredicate&& Predicate, const int32 MinChunkSize = 16384)
+	{
+		const int32 N = Items.Num();
+		if (N <= MinChunkSize)
+		{
+			Items.Sort(Predicate);
+			return;
+		}
+
+		const int32 NumChunks = FMath::Min(FMath::DivideAndRoundUp(N, MinChunkSize), 64);
+		const int32 ChunkSize = FMath::DivideAndRoundUp(N, NumChunks);
+
+		ParallelFor(
+			NumChunks, [&](const int32 c)
+			{
+				const int32 Start = c * ChunkSize;
+				const int32 Count = FMath::Min(N, Start + ChunkSize) - Start;
+				if (Count > 1) { Algo::Sort(TArrayView<T>(Items.GetData() + Start, Count), Predicate); }
+			});
+
+		TArray<T> Temp;
+		Temp.SetNumUninitialized(N);
+
+		T* Curr = Items.GetData();
+		T* Out = Temp.GetData();
+
+		for (int32 Width = ChunkSize; Width < N; Width *= 2)
+		{
+			const int32 NumMerges = FMath::DivideAndRoundUp(N, Width * 2);
+
+			ParallelFor(
+				NumMerges, [&](const int32 m)
+				{
+					const int32 Start = m * Width * 2;
+					const int32 Mid = FMath::Min(N, Start + Width);
+					const int32 End = FMath::Min(N, Start + Width * 2);
+
+					// Right side only wins strict comparisons, which keeps the merge stable
+					int32 L = Start;
+					int32 R = Mid;
+					int32 W = Start;
+					while (L < Mid && R < End) { Out[W++] = Predicate(Curr[R], Curr[L]) ? Curr[R++] : Curr[L++]; }
+					while (L < Mid) { Out[W++] = Curr[L++]; }
+					while (R < End) { Out[W++] = Curr[R++]; }
+				}, NumMerges == 1);
+
+			Swap(Curr, Out);
+		}
+
+		if (Curr != Items.GetData()) { Items = MoveTemp(Temp); }
+	}
+
+	static void ParallelRadixSort(TArray<uint64>& Keys)
+	{
+		ParallelRadixSort(Keys, [](const uint64 Key) { return Key; });
+	}
+
+	static void ParallelRadixSort(TArray<FIndexKey>& Keys)
+	{
+		ParallelRadixSort(Keys, [](const FIndexKey& Key) { return Key.Key; });
+	}
 }
@@ -274,6 +274,10 @@ bool FPCGExWaitForPCGDataElement::AdvanceWork(FPCGExContext* InContext, const UP
 
 namespace PCGExWaitForPCGData
 {
+	// Missing references are re-resolved on a doubling delay, for actors that show up without raising a subsystem event
+	constexpr float ResolveRetryMinDelay = 0.25f;
+	constexpr float ResolveRetryMaxDelay = 8.0f;
+
 	FComponentDiscovery::FComponentDiscovery(
 		FPCGExWaitForPCGDataContext* InContext,
 		const TSharedPtr<PCGExMT::FTaskManager>& InTaskManager,
@@ -301,7 +305,7 @@ namespace PCGExWaitForPCGData
 		if (!TaskManager) { return false; }
 
 		UniqueActorReferences = InActorReferences;
-		QueuedActors.Reserve(UniqueActorReferences.Num());
+		PendingInspection.Reserve(UniqueActorReferences.Num());
 
 		InspectionTracker = MakeShared<FPCGExIntTracker>([WeakThis = TWeakPtr<FComponentDiscovery>(SharedThis(this))]()
 		{
@@ -311,121 +315,167 @@ namespace PCGExWaitForPCGData
 			}
 		});
 
-		if (TimeoutConfig.bWaitForMissingActors)
+		for (const FSoftObjectPath& ActorRef : UniqueActorReferences)
 		{
-			StartTime = Context->GetWorld()->GetTimeSeconds();
-			SearchActorsToken = TaskManager->TryCreateToken(FName("SearchActors"));
-			if (!SearchActorsToken.IsValid()) { return false; }
-			GatherActors();
+			if (AActor* Actor = Cast<AActor>(ActorRef.ResolveObject())) { PendingInspection.Add(Actor); }
+			else { PendingActorReferences.Add(ActorRef); }
 		}
-		else
+
+		if (TimeoutConfig.bWaitForMissingActors && !PendingActorReferences.IsEmpty())
 		{
-			bool bHasUnresolvedReferences = false;
+			SearchActorsToken = TaskManager->TryCreateToken(FName("SearchActors"));
+			if (!SearchActorsToken.IsValid()) { return false; }
+
+			ArmTimeout(TimeoutConfig.WaitForActorTimeout, [](const TSharedPtr<FComponentDiscovery>& This) { This->OnActorTimeout(); });
+			ArmResolveRetry(ResolveRetryMinDelay);
+
+			// Sleep until the subsystem reports one of the missing actors
+			TWeakPtr<FComponentDiscovery> WeakThis = SharedThis(this);
+			const TArray<FSoftObjectPath> MissingReferences = PendingActorReferences.Array();
+
+			PCGEX_SUBSYSTEM
+			for (const FSoftObjectPath& ActorRef : MissingReferences)
+			{
+				PCGExSubsystem->WatchActor(ActorRef, this, [WeakThis, ActorRef](AActor* InActor)
+				{
+					if (TSharedPtr<FComponentDiscovery> This = WeakThis.Pin())
+					{
+						This->OnActorAvailable(ActorRef, InActor);
+					}
+				});
+			}
 
-			for (const FSoftObjectPath& ActorRef : UniqueActorReferences)
+			// Catch actors that showed up between the first resolve and the subscription
+			for (const FSoftObjectPath& ActorRef : MissingReferences)
 			{
-				if (AActor* Actor = Cast<AActor>(ActorRef.ResolveObject())) { QueuedActors.Add(Actor); }
-				else { bHasUnresolvedReferences = true; }
+				if (AActor* Actor = Cast<AActor>(ActorRef.ResolveObject())) { OnActorAvailable(ActorRef, Actor); }
 			}
 
-			if (QueuedActors.IsEmpty() && !WarningConfig.bQuietActorNotFoundWarning)
+			return true;
+		}
+
+		if (!TimeoutConfig.bWaitForMissingActors)
+		{
+			if (PendingInspection.IsEmpty() && !WarningConfig.bQuietActorNotFoundWarning)
 			{
 				PCGE_LOG_C(Warning, GraphAndLog, Context, FTEXT("Could not resolve any actor references."));
 				return false;
 			}
 
-			if (bHasUnresolvedReferences && !WarningConfig.bQuietActorNotFoundWarning)
+			if (!PendingActorReferences.IsEmpty() && !WarningConfig.bQuietActorNotFoundWarning)
 			{
 				PCGE_LOG_C(Warning, GraphAndLog, Context, FTEXT("Some actor references could not be resolved."));
 			}
-
-			// Start component search
-			SearchComponentsToken = TaskManager->TryCreateToken(FName("SearchComponents"));
-			if (!SearchComponentsToken.IsValid()) { return false; }
-
-			StartTime = Context->GetWorld()->GetTimeSeconds();
-
-			PCGEX_SUBSYSTEM
-			PCGExSubsystem->RegisterBeginTickAction([WeakThis = TWeakPtr<FComponentDiscovery>(SharedThis(this))]()
-			{
-				if (TSharedPtr<FComponentDiscovery> This = WeakThis.Pin())
-				{
-					This->GatherComponents();
-				}
-			});
 		}
 
-		return true;
+		return StartComponentSearch();
 	}
 
 	void FComponentDiscovery::Stop()
 	{
+		ClearTimeout();
+		ClearResolveRetry();
+		UnwatchActors();
 		PCGEX_ASYNC_RELEASE_TOKEN(SearchActorsToken)
 		PCGEX_ASYNC_RELEASE_TOKEN(SearchComponentsToken)
 	}
 
-	void FComponentDiscovery::GatherActors()
+	void FComponentDiscovery::OnActorAvailable(const FSoftObjectPath& InActorReference, AActor* InActor)
 	{
-		if (!SearchActorsToken.IsValid()) { return; }
-
-		TSharedPtr<PCGExMT::FTaskManager> TaskManager = TaskManagerWeak.Pin();
-		if (!TaskManager || !TaskManager->IsAvailable())
 		{
-			PCGEX_ASYNC_RELEASE_TOKEN(SearchActorsToken)
-			return;
+			FScopeLock Lock(&StateLock);
+			if (!SearchActorsToken.IsValid() || !PendingActorReferences.Remove(InActorReference)) { return; }
+
+			PendingInspection.Add(InActor);
+			if (!PendingActorReferences.IsEmpty()) { return; }
 		}
 
-		bool bHasUnresolvedReferences = false;
+		// All actors found - start component search
+		ClearTimeout();
+		ClearResolveRetry();
+		UnwatchActors(); // Actors caught by a retry are still watched
 
-		QueuedActors.Reset(UniqueActorReferences.Num());
-		for (const FSoftObjectPath& ActorRef : UniqueActorReferences)
+		const bool bStarted = StartComponentSearch();
+		PCGEX_ASYNC_RELEASE_TOKEN(SearchActorsToken)
+
+		if (!bStarted)
 		{
-			if (AActor* Actor = Cast<AActor>(ActorRef.ResolveObject())) { QueuedActors.Add(Actor); }
-			else { bHasUnresolvedReferences = true; }
+			Stop();
+			if (OnDiscoveryComplete) { OnDiscoveryComplete(); }
 		}
+	}
 
-		if (bHasUnresolvedReferences)
+	void FComponentDiscovery::OnActorTimeout()
+	{
 		{
-			if (Context->GetWorld()->GetTimeSeconds() - StartTime < TimeoutConfig.WaitForActorTimeout)
-			{
-				PCGEX_SUBSYSTEM
-				PCGExSubsystem->RegisterBeginTickAction([WeakThis = TWeakPtr<FComponentDiscovery>(SharedThis(this))]()
-				{
-					if (TSharedPtr<FComponentDiscovery> This = WeakThis.Pin())
-					{
-						This->GatherActors();
-					}
-				});
-				return;
-			}
+			FScopeLock Lock(&StateLock);
+			if (!SearchActorsToken.IsValid()) { return; }
 
-			// Timeout - log errors
 			if (!WarningConfig.bQuietTimeoutError)
 			{
-				for (const FSoftObjectPath& ActorRef : UniqueActorReferences)
+				for (const FSoftObjectPath& ActorRef : PendingActorReferences)
 				{
-					if (Cast<AActor>(ActorRef.ResolveObject())) { continue; }
 					FString Rel = TEXT("TIMEOUT : ") + ActorRef.ToString() + TEXT(" not found.");
 					PCGE_LOG_C(Error, GraphAndLog, Context, FText::FromString(Rel));
 				}
 			}
-
-			PCGEX_ASYNC_RELEASE_TOKEN(SearchActorsToken)
-			if (OnDiscoveryComplete) { OnDiscoveryComplete(); }
-			return;
 		}
 
-		// All actors found - start component search
-		PCGEX_ASYNC_RELEASE_TOKEN(SearchActorsToken)
+		Stop();
+		if (OnDiscoveryComplete) { OnDiscoveryComplete(); }
+	}
+
+	bool FComponentDiscovery::StartComponentSearch()
+	{
+		TSharedPtr<PCGExMT::FTaskManager> TaskManager = TaskManagerWeak.Pin();
+		if (!TaskManager) { return false; }
 
 		SearchComponentsToken = TaskManager->TryCreateToken(FName("SearchComponents"));
-		if (!SearchComponentsToken.IsValid())
+		if (!SearchComponentsToken.IsValid()) { return false; }
+
+		if (TimeoutConfig.bWaitForMissingComponents)
 		{
-			if (OnDiscoveryComplete) { OnDiscoveryComplete(); }
-			return;
+			ArmTimeout(TimeoutConfig.WaitForComponentTimeout, [](const TSharedPtr<FComponentDiscovery>& This) { This->OnComponentTimeout(); });
 		}
 
-		StartTime = Context->GetWorld()->GetTimeSeconds();
+		ScheduleInspection();
+		return true;
+	}
+
+	bool FComponentDiscovery::OnActorChanged(AActor* InActor)
+	{
+		{
+			FScopeLock Lock(&StateLock);
+			if (!SearchComponentsToken.IsValid() || !WaitingActors.Remove(InActor)) { return false; }
+			PendingInspection.Add(InActor);
+		}
+
+		ScheduleInspection();
+		return true;
+	}
+
+	void FComponentDiscovery::OnComponentTimeout()
+	{
+		{
+			FScopeLock Lock(&StateLock);
+			if (!SearchComponentsToken.IsValid()) { return; }
+
+			// Give every waiting actor one last look before reporting them
+			bTimedOut = true;
+			PendingInspection.Append(WaitingActors.Array());
+			WaitingActors.Reset();
+		}
+
+		ScheduleInspection();
+	}
+
+	void FComponentDiscovery::ScheduleInspection()
+	{
+		{
+			FScopeLock Lock(&StateLock);
+			if (bInspectionScheduled) { return; }
+			bInspectionScheduled = true;
+		}
 
 		PCGEX_SUBSYSTEM
 		PCGExSubsystem->RegisterBeginTickAction([WeakThis = TWeakPtr<FComponentDiscovery>(SharedThis(this))]()
@@ -449,6 +499,18 @@ namespace PCGExWaitForPCGData
 			return;
 		}
 
+		{
+			FScopeLock Lock(&StateLock);
+			QueuedActors = MoveTemp(PendingInspection);
+			PendingInspection.Reset();
+		}
+
+		if (QueuedActors.IsEmpty())
+		{
+			OnInspectionCompleteInternal();
+			return;
+		}
+
 		PerActorGatheredComponents.Reset();
 		PerActorGatheredComponents.SetNum(QueuedActors.Num());
 
@@ -519,7 +581,7 @@ namespace PCGExWaitForPCGData
 
 		if (TimeoutConfig.bWaitForMissingComponents && FoundComponents.IsEmpty())
 		{
-			// Wait until next run - don't mark actor as processed
+			// Keep waiting - don't mark actor as processed
 			return;
 		}
 
@@ -544,41 +606,187 @@ namespace PCGExWaitForPCGData
 		// Compact the queued actors array - remove processed (nullptr) entries
 		QueuedActors.RemoveAll([](const AActor* Actor) { return Actor == nullptr; });
 
-		// If some actors still have no valid components, retry or timeout
-		if (!QueuedActors.IsEmpty())
+		TArray<AActor*> NewWaitingActors = MoveTemp(QueuedActors);
+		QueuedActors.Reset();
+
+		bool bHasPendingInspection = false;
+		bool bKeepWaiting = false;
+
+		{
+			FScopeLock Lock(&StateLock);
+
+			bInspectionScheduled = false;
+			WaitingActors.Append(NewWaitingActors);
+
+			bHasPendingInspection = !PendingInspection.IsEmpty();
+			bKeepWaiting = !bTimedOut && !WaitingActors.IsEmpty();
+		}
+
+		// Events came in while inspecting
+		if (bHasPendingInspection)
+		{
+			ScheduleInspection();
+			return;
+		}
+
+		// Some actors still have no valid components; sleep until the subsystem reports a change on them
+		if (bKeepWaiting)
+		{
+			WatchWaitingActors();
+			return;
+		}
+
+		// Timeout
+		if (bTimedOut && !WarningConfig.bQuietTimeoutError)
 		{
-			if (Context->GetWorld()->GetTimeSeconds() - StartTime < TimeoutConfig.WaitForComponentTimeout)
+			FScopeLock Lock(&StateLock);
+			for (const AActor* Actor : WaitingActors)
 			{
-				PCGEX_SUBSYSTEM
-				PCGExSubsystem->RegisterBeginTickAction([WeakThis = TWeakPtr<FComponentDiscovery>(SharedThis(this))]()
+				FString Rel = TEXT("TIMEOUT : ") + Actor->GetName() + TEXT(" does not have ") + TemplateGraph.GetName();
+				PCGE_LOG_C(Error, GraphAndLog, Context, FText::FromString(Rel));
+			}
+		}
+
+		Stop();
+
+		if (OnDiscoveryComplete)
+		{
+			OnDiscoveryComplete();
+		}
+	}
+
+	void FComponentDiscovery::ArmTimeout(const float InDelay, TFunction<void(const TSharedPtr<FComponentDiscovery>&)>&& OnTimeout)
+	{
+		ClearTimeout();
+
+		TimeoutHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateLambda(
+				[WeakThis = TWeakPtr<FComponentDiscovery>(SharedThis(this)), OnTimeout = MoveTemp(OnTimeout)](float)
 				{
 					if (TSharedPtr<FComponentDiscovery> This = WeakThis.Pin())
 					{
-						This->GatherComponents();
+						This->TimeoutHandle.Reset();
+						OnTimeout(This);
 					}
-				});
-				return;
-			}
+					return false;
+				}), InDelay);
+	}
 
-			// Timeout
-			if (!WarningConfig.bQuietTimeoutError)
-			{
-				for (const AActor* Actor : QueuedActors)
+	void FComponentDiscovery::ClearTimeout()
+	{
+		if (!TimeoutHandle.IsValid()) { return; }
+		FTSTicker::GetCoreTicker().RemoveTicker(TimeoutHandle);
+		TimeoutHandle.Reset();
+	}
+
+	void FComponentDiscovery::ArmResolveRetry(const float InDelay)
+	{
+		ClearResolveRetry();
+
+		ResolveRetryHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateLambda(
+				[WeakThis = TWeakPtr<FComponentDiscovery>(SharedThis(this)), InDelay](float)
 				{
-					FString Rel = TEXT("TIMEOUT : ") + Actor->GetName() + TEXT(" does not have ") + TemplateGraph.GetName();
-					PCGE_LOG_C(Error, GraphAndLog, Context, FText::FromString(Rel));
-				}
-			}
+					if (TSharedPtr<FComponentDiscovery> This = WeakThis.Pin())
+					{
+						This->ResolveRetryHandle.Reset();
+						This->RetryResolve(InDelay);
+					}
+					return false;
+				}), InDelay);
+	}
+
+	void FComponentDiscovery::RetryResolve(const float InDelay)
+	{
+		TArray<FSoftObjectPath> MissingReferences;
+
+		{
+			FScopeLock Lock(&StateLock);
+			if (!SearchActorsToken.IsValid()) { return; }
+			MissingReferences = PendingActorReferences.Array();
 		}
 
-		Stop();
+		for (const FSoftObjectPath& ActorRef : MissingReferences)
+		{
+			if (AActor* Actor = Cast<AActor>(ActorRef.ResolveObject())) { OnActorAvailable(ActorRef, Actor); }
+		}
 
-		if (OnDiscoveryComplete)
 		{
-			OnDiscoveryComplete();
+			FScopeLock Lock(&StateLock);
+			if (!SearchActorsToken.IsValid()) { return; }
+		}
+
+		ArmResolveRetry(FMath::Min(InDelay * 2, ResolveRetryMaxDelay));
+	}
+
+	void FComponentDiscovery::ClearResolveRetry()
+	{
+		if (!ResolveRetryHandle.IsValid()) { return; }
+		FTSTicker::GetCoreTicker().RemoveTicker(ResolveRetryHandle);
+		ResolveRetryHandle.Reset();
+	}
+
+	void FComponentDiscovery::WatchWaitingActors()
+	{
+		// Re-subscribe from scratch so actors that were already watched don't pile up watchers
+		UnwatchActors();
+
+		// Candidates must carry the tag, so a single subscription covers every waiting actor
+		if (!FilterConfig.MustHaveTag.IsNone())
+		{
+			WatchComponentTag();
+			return;
+		}
+
+		TArray<AActor*> ActorsToWatch;
+
+		{
+			FScopeLock Lock(&StateLock);
+			ActorsToWatch = WaitingActors.Array();
+		}
+
+		TWeakPtr<FComponentDiscovery> WeakThis = SharedThis(this);
+
+		PCGEX_SUBSYSTEM
+		for (AActor* Actor : ActorsToWatch)
+		{
+			PCGExSubsystem->WatchActor(FSoftObjectPath(Actor), this, [WeakThis](AActor* InActor)
+			{
+				if (TSharedPtr<FComponentDiscovery> This = WeakThis.Pin())
+				{
+					This->OnActorChanged(InActor);
+				}
+			});
 		}
 	}
 
+	void FComponentDiscovery::WatchComponentTag()
+	{
+		PCGEX_SUBSYSTEM
+		PCGExSubsystem->WatchComponentTag(FilterConfig.MustHaveTag, this, [WeakThis = TWeakPtr<FComponentDiscovery>(SharedThis(this))](AActor* InActor)
+		{
+			TSharedPtr<FComponentDiscovery> This = WeakThis.Pin();
+			if (!This) { return; }
+
+			// Tagged component on an actor we don't wait for; the subscription was consumed, keep listening
+			if (This->OnActorChanged(InActor)) { return; }
+
+			bool bKeepWaiting = false;
+
+			{
+				FScopeLock Lock(&This->StateLock);
+				bKeepWaiting = This->SearchComponentsToken.IsValid() && !This->bTimedOut && !This->WaitingActors.IsEmpty();
+			}
+
+			if (bKeepWaiting) { This->WatchComponentTag(); }
+		});
+	}
+
+	void FComponentDiscovery::UnwatchActors() const
+	{
+		if (UPCGExSubSystem* PCGExSubsystem = UPCGExSubSystem::GetSubsystemForCurrentWorld()) { PCGExSubsystem->UnwatchActors(this); }
+	}
+
 	bool FComponentDiscovery::IsValidCandidate(const UPCGComponent* Candidate) const
 	{
 		return FilterConfig.PassesFilter(Candidate, TemplateGraph.Get(), Context->GetMutableComponent());
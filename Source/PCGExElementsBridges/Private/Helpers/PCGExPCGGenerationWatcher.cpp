@@ -5,6 +5,7 @@
 
 #include "PCGComponent.h"
 #include "PCGSubsystem.h"
+#include "PCGExSubSystem.h"
 #include "Core/PCGExMT.h"
 #include "Utils/PCGExIntTracker.h"
 
@@ -223,6 +224,12 @@ void PCGExPCGInterop::FGenerationWatcher::WatchComponentGeneration(UPCGComponent
 
 void PCGExPCGInterop::FGenerationWatcher::OnComponentReady(UPCGComponent* InComponent, bool bSuccess)
 {
+	// Freshly generated output may be what another discovery is waiting on
+	if (bSuccess && InComponent)
+	{
+		if (UPCGExSubSystem* PCGExSubsystem = UPCGExSubSystem::GetInstance(InComponent->GetWorld())) { PCGExSubsystem->NotifyComponentChanged(InComponent); }
+	}
+
 	if (OnGenerationComplete)
 	{
 		OnGenerationComplete(InComponent, bSuccess);
@@ -5,6 +5,7 @@
 
 #include "CoreMinimal.h"
 #include "PCGComponent.h"
+#include "Containers/Ticker.h"
 #include "Core/PCGExPointsProcessor.h"
 #include "Data/Utils/PCGExDataForwardDetails.h"
 #include "Helpers/PCGExPCGGenerationWatcher.h"
@@ -270,9 +271,13 @@ namespace PCGExWaitForPCGData
 	// Component Discovery - Handles finding and filtering PCG components on target actors
 	//
 	// State Machine:
-	// [Start] -> GatherActors -> (wait for actors if needed) -> GatherComponents -> InspectComponents -> [Complete]
-	//                ^                                                                    |
-	//                +-----------------(retry if waiting for components)------------------+
+	// [Start] -> (watch missing actors) -> GatherComponents -> InspectComponents -> [Complete]
+	//                                            ^                     |
+	//                                            +--(actor event)------+ (watch actors without valid components)
+	//
+	// Waiting is event-driven: missing or incomplete actors are watched through UPCGExSubSystem::WatchActor
+	// (or a single WatchComponentTag when a tag is required) and re-inspected when the subsystem reports them,
+	// plus one last pass when the timeout expires. Missing actor references are also re-resolved on a backed-off retry.
 	//
 	class FComponentDiscovery final : public TSharedFromThis<FComponentDiscovery>
 	{
@@ -296,12 +301,30 @@ namespace PCGExWaitForPCGData
 		void Stop();
 
 	private:
-		void GatherActors();
+		void OnActorAvailable(const FSoftObjectPath& InActorReference, AActor* InActor);
+		void OnActorTimeout();
+
+		bool StartComponentSearch();
+		bool OnActorChanged(AActor* InActor);
+		void OnComponentTimeout();
+
+		void ScheduleInspection();
 		void GatherComponents();
 		void InspectGatheredComponents();
 		void Inspect(int32 Index);
 		void OnInspectionCompleteInternal();
 
+		void ArmTimeout(const float InDelay, TFunction<void(const TSharedPtr<FComponentDiscovery>&)>&& OnTimeout);
+		void ClearTimeout();
+
+		void ArmResolveRetry(const float InDelay);
+		void RetryResolve(const float InDelay);
+		void ClearResolveRetry();
+
+		void WatchWaitingActors();
+		void WatchComponentTag();
+		void UnwatchActors() const;
+
 		bool IsValidCandidate(const UPCGComponent* Candidate) const;
 		bool HasRequiredPins(const UPCGGraph* CandidateGraph) const;
 
@@ -316,10 +339,19 @@ namespace PCGExWaitForPCGData
 		TWeakPtr<PCGExMT::FAsyncToken> SearchActorsToken;
 		TWeakPtr<PCGExMT::FAsyncToken> SearchComponentsToken;
 		TSharedPtr<FPCGExIntTracker> InspectionTracker;
+		FTSTicker::FDelegateHandle TimeoutHandle;
+		FTSTicker::FDelegateHandle ResolveRetryHandle;
+
+		// Guards the waiting state below, which is touched by subsystem events, inspection tasks and timeouts
+		FCriticalSection StateLock;
+		bool bInspectionScheduled = false;
+		bool bTimedOut = false;
 
-		double StartTime = 0;
 		TSet<FSoftObjectPath> UniqueActorReferences;
-		TArray<AActor*> QueuedActors;
+		TSet<FSoftObjectPath> PendingActorReferences; // Not in the world yet
+		TArray<AActor*> PendingInspection;            // Due for the next inspection pass
+		TSet<AActor*> WaitingActors;                  // Inspected, but without any valid component so far
+		TArray<AActor*> QueuedActors;                 // Being inspected
 		TArray<TArray<UPCGComponent*>> PerActorGatheredComponents;
 
 		FOnDiscoveryComplete OnComponentFound;
@@ -19,6 +19,8 @@
 #include "Core/PCGExUnionData.h"
 #include "Math/PCGExMathDistances.h"
 #include "Async/ParallelFor.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Unique.h"
 
 #define LOCTEXT_NAMESPACE "PCGExClipper2ProcessorElement"
 
@@ -80,55 +82,476 @@ namespace PCGExClipper2
 		AllSourceIndices.Append(OperandIndices);
 	}
 
-	void FProcessingGroup::PreProcess(const UPCGExClipper2ProcessorSettings* InSettings)
+	namespace Internal
 	{
+		FORCEINLINE bool IsSeam(const PCGExClipper2Lib::Point64& Pt)
+		{
+			return PCGEx::H64A(static_cast<uint64>(Pt.z)) == SEAM_MARKER;
+		}
+
+		FORCEINLINE uint64 Part1By1(uint64 V)
+		{
+			V &= 0xFFFFFFFF;
+			V = (V | (V << 16)) & 0x0000FFFF0000FFFF;
+			V = (V | (V << 8)) & 0x00FF00FF00FF00FF;
+			V = (V | (V << 4)) & 0x0F0F0F0F0F0F0F0F;
+			V = (V | (V << 2)) & 0x3333333333333333;
+			V = (V | (V << 1)) & 0x5555555555555555;
+			return V;
+		}
+
+		// Reorder paths along a Morton curve of their bounds centers so contiguous ranges are spatially coherent
+		void SortPathsSpatially(PCGExClipper2Lib::Paths64& InOutPaths)
+		{
+			const int32 NumPaths = static_cast<int32>(InOutPaths.size());
+			if (NumPaths < 2) { return; }
+
+			const PCGExClipper2Lib::Rect64 Bounds = PCGExClipper2Lib::GetBounds(InOutPaths);
+			const double W = FMath::Max(1.0, static_cast<double>(Bounds.Width()));
+			const double H = FMath::Max(1.0, static_cast<double>(Bounds.Height()));
+
+			TArray<PCGEx::FIndexKey> Keys;
+			Keys.SetNumUninitialized(NumPaths);
+
+			ParallelFor(
+				NumPaths, [&](const int32 i)
+				{
+					const PCGExClipper2Lib::Point64 Mid = PCGExClipper2Lib::GetBounds(InOutPaths[i]).MidPoint();
+					const uint64 X = static_cast<uint64>(FMath::Clamp((static_cast<double>(Mid.x - Bounds.left) / W) * 65535.0, 0.0, 65535.0));
+					const uint64 Y = static_cast<uint64>(FMath::Clamp((static_cast<double>(Mid.y - Bounds.top) / H) * 65535.0, 0.0, 65535.0));
+					Keys[i] = PCGEx::FIndexKey(i, Part1By1(X) | (Part1By1(Y) << 1));
+				}, NumPaths < 1024);
+
+			Keys.Sort([](const PCGEx::FIndexKey& A, const PCGEx::FIndexKey& B) { return A.Key == B.Key ? A.Index < B.Index : A.Key < B.Key; });
+
+			PCGExClipper2Lib::Paths64 Sorted;
+			Sorted.reserve(NumPaths);
+			for (const PCGEx::FIndexKey& Key : Keys) { Sorted.push_back(MoveTemp(InOutPaths[Key.Index])); }
+			InOutPaths = MoveTemp(Sorted);
+		}
+
+		FORCEINLINE bool IsAllPositive(const PCGExClipper2Lib::Paths64& InPaths)
+		{
+			for (const PCGExClipper2Lib::Path64& Path : InPaths) { if (!PCGExClipper2Lib::IsPositive(Path)) { return false; } }
+			return true;
+		}
+
+		// Sorted, unique coordinates of every vertex along one axis
+		void GatherCoordinates(const PCGExClipper2Lib::Paths64& InA, const PCGExClipper2Lib::Paths64& InB, const bool bY, TArray<int64>& OutCoordinates)
+		{
+			OutCoordinates.Reset();
+			for (const PCGExClipper2Lib::Paths64* Paths : {&InA, &InB})
+			{
+				for (const PCGExClipper2Lib::Path64& Path : *Paths)
+				{
+					for (const PCGExClipper2Lib::Point64& Pt : Path) { OutCoordinates.Add(bY ? Pt.y : Pt.x); }
+				}
+			}
+
+			OutCoordinates.Sort();
+			OutCoordinates.SetNum(Algo::Unique(OutCoordinates));
+		}
+
+		/**
+		 * Evenly spaced seam lines between Min & Max, each moved to the next coordinate no input vertex uses.
+		 * No input vertex can then sit on a seam, so any output vertex tagged as seam was created by the tiling and is safe to strip.
+		 */
+		void ComputeSeams(const int64 Min, const int64 Max, const int32 NumTiles, const TArray<int64>& UsedCoordinates, TArray<int64>& OutSeams)
+		{
+			const int64 Step = FMath::DivideAndRoundUp<int64>(Max - Min, NumTiles);
+
+			OutSeams.SetNumUninitialized(NumTiles + 1);
+			OutSeams[0] = Min;
+			OutSeams[NumTiles] = Max;
+
+			for (int32 i = 1; i < NumTiles; i++)
+			{
+				int64 Seam = FMath::Max(Min + i * Step, OutSeams[i - 1] + 1);
+				int32 Index = Algo::LowerBound(UsedCoordinates, Seam);
+				while (Seam < Max && UsedCoordinates.IsValidIndex(Index) && UsedCoordinates[Index] == Seam)
+				{
+					Seam++;
+					Index++;
+				}
+
+				// Max is padded away from geometry; degenerate trailing tiles are simply empty
+				OutSeams[i] = FMath::Min(Seam, Max);
+			}
+		}
+	}
+
+	bool FProcessingGroup::PreProcess(const UPCGExClipper2ProcessorSettings* InSettings)
+	{
+		// Paths are unioned as given. Reversed paths must keep cancelling what they overlap,
+		// which only a single execution honors; the tree reduction is reserved to same-signed inputs.
+		auto GetLeafSize = [&](const PCGExClipper2Lib::Paths64& InPaths)
+		{
+			return InSettings->bParallelUnion && Internal::IsAllPositive(InPaths) ? InSettings->ParallelUnionLeafSize : 0;
+		};
+
 		if (InSettings->bUnionGroupBeforeOperation && SubjectPaths.size() > 1)
 		{
-			PCGExClipper2Lib::Paths64 Union;
-			PCGExClipper2Lib::Clipper64 Clipper;
-			Clipper.SetZCallback(CreateZCallback());
-			Clipper.AddSubject(SubjectPaths);
-			Clipper.AddOpenSubject(OpenSubjectPaths);
-			Clipper.Execute(PCGExClipper2Lib::ClipType::Union, PCGExClipper2Lib::FillRule::NonZero, Union);
-			SubjectPaths = Union;
+			// Open subjects never contribute to the closed union output
+			if (!UnionInPlace(SubjectPaths, GetLeafSize(SubjectPaths))) { return false; }
 		}
 
 		if (InSettings->bUnionOperandsBeforeOperation && OperandPaths.size() > 1)
+		{
+			if (!UnionInPlace(OperandPaths, GetLeafSize(OperandPaths))) { return false; }
+		}
+
+		return true;
+	}
+
+	bool FProcessingGroup::UnionInPlace(PCGExClipper2Lib::Paths64& InOutPaths, const int32 LeafSize)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FProcessingGroup::UnionInPlace)
+
+		const int32 NumPaths = static_cast<int32>(InOutPaths.size());
+
+		if (LeafSize <= 1 || NumPaths <= LeafSize)
 		{
 			PCGExClipper2Lib::Paths64 Union;
 			PCGExClipper2Lib::Clipper64 Clipper;
 			Clipper.SetZCallback(CreateZCallback());
-			Clipper.AddSubject(OperandPaths);
-			Clipper.AddOpenSubject(OpenOperandPaths);
-			Clipper.Execute(PCGExClipper2Lib::ClipType::Union, PCGExClipper2Lib::FillRule::NonZero, Union);
-			OperandPaths = Union;
+			Clipper.AddSubject(InOutPaths);
+			if (!Clipper.Execute(PCGExClipper2Lib::ClipType::Union, PCGExClipper2Lib::FillRule::NonZero, Union)) { return false; }
+			InOutPaths = MoveTemp(Union);
+			return true;
+		}
+
+		// Spatially coherent leaves keep pairwise merges cheap, as most overlaps are resolved early
+		Internal::SortPathsSpatially(InOutPaths);
+
+		const int32 NumLeaves = FMath::DivideAndRoundUp(NumPaths, LeafSize);
+		TArray<PCGExClipper2Lib::Paths64> Partials;
+		Partials.SetNum(NumLeaves);
+
+		std::atomic<bool> bFailed{false};
+
+		ParallelFor(
+			NumLeaves, [&](const int32 i)
+			{
+				const int32 Start = i * LeafSize;
+				const int32 End = FMath::Min(Start + LeafSize, NumPaths);
+
+				PCGExClipper2Lib::Clipper64 Clipper;
+				Clipper.SetZCallback(CreateZCallback());
+				Clipper.AddSubject(PCGExClipper2Lib::Paths64(InOutPaths.begin() + Start, InOutPaths.begin() + End));
+				if (!Clipper.Execute(PCGExClipper2Lib::ClipType::Union, PCGExClipper2Lib::FillRule::NonZero, Partials[i])) { bFailed = true; }
+			});
+
+		if (bFailed) { return false; }
+
+		// Pairwise reduction; neighbors in the Morton order are merged together
+		while (Partials.Num() > 1)
+		{
+			const int32 NumPairs = Partials.Num() / 2;
+			TArray<PCGExClipper2Lib::Paths64> Merged;
+			Merged.SetNum(FMath::DivideAndRoundUp(Partials.Num(), 2));
+
+			ParallelFor(
+				NumPairs, [&](const int32 i)
+				{
+					PCGExClipper2Lib::Paths64& A = Partials[i * 2];
+					PCGExClipper2Lib::Paths64& B = Partials[i * 2 + 1];
+
+					if (A.empty()) { Merged[i] = MoveTemp(B); }
+					else if (B.empty()) { Merged[i] = MoveTemp(A); }
+					else
+					{
+						PCGExClipper2Lib::Clipper64 Clipper;
+						Clipper.SetZCallback(CreateZCallback());
+						Clipper.AddSubject(A);
+						Clipper.AddSubject(B);
+						if (!Clipper.Execute(PCGExClipper2Lib::ClipType::Union, PCGExClipper2Lib::FillRule::NonZero, Merged[i])) { bFailed = true; }
+					}
+				});
+
+			if (bFailed) { return false; }
+
+			if (Partials.Num() % 2 != 0) { Merged.Last() = MoveTemp(Partials.Last()); }
+			Partials = MoveTemp(Merged);
 		}
+
+		InOutPaths = MoveTemp(Partials[0]);
+		return true;
+	}
+
+	bool FProcessingGroup::ExecuteBoolean(
+		const UPCGExClipper2ProcessorSettings* InSettings,
+		const PCGExClipper2Lib::ClipType InClipType, const PCGExClipper2Lib::FillRule InFillRule,
+		PCGExClipper2Lib::Paths64& OutClosed, PCGExClipper2Lib::Paths64& OutOpen)
+	{
+		const bool bClosedOnly = OpenSubjectPaths.empty() && OpenOperandPaths.empty();
+
+		if (bClosedOnly)
+		{
+			// A Non-Zero union of same-signed paths is associative; it can be reduced as a tree.
+			// Reversed paths must keep cancelling what they overlap, which only a single execution honors.
+			if (InSettings->bParallelUnion && InClipType == PCGExClipper2Lib::ClipType::Union && InFillRule == PCGExClipper2Lib::FillRule::NonZero
+				&& Internal::IsAllPositive(SubjectPaths) && Internal::IsAllPositive(OperandPaths))
+			{
+				OutClosed.reserve(SubjectPaths.size() + OperandPaths.size());
+				OutClosed.insert(OutClosed.end(), SubjectPaths.begin(), SubjectPaths.end());
+				OutClosed.insert(OutClosed.end(), OperandPaths.begin(), OperandPaths.end());
+				return UnionInPlace(OutClosed, InSettings->ParallelUnionLeafSize);
+			}
+
+			if (InSettings->bTileLargeOperations && static_cast<int32>(SubjectPaths.size() + OperandPaths.size()) >= InSettings->TilingThreshold)
+			{
+				return ExecuteTiled(InSettings, InClipType, InFillRule, OutClosed);
+			}
+		}
+
+		PCGExClipper2Lib::Clipper64 Clipper;
+		Clipper.SetZCallback(CreateZCallback());
+
+		if (!SubjectPaths.empty()) { Clipper.AddSubject(SubjectPaths); }
+		if (!OpenSubjectPaths.empty()) { Clipper.AddOpenSubject(OpenSubjectPaths); }
+
+		if (!OperandPaths.empty()) { Clipper.AddClip(OperandPaths); }
+		if (!OpenOperandPaths.empty()) { Clipper.AddClip(OpenOperandPaths); }
+
+		return Clipper.Execute(InClipType, InFillRule, OutClosed, OutOpen);
+	}
+
+	bool FProcessingGroup::ExecuteTiled(
+		const UPCGExClipper2ProcessorSettings* InSettings,
+		const PCGExClipper2Lib::ClipType InClipType, const PCGExClipper2Lib::FillRule InFillRule,
+		PCGExClipper2Lib::Paths64& OutClosed)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FProcessingGroup::ExecuteTiled)
+
+		const int32 NumSubjects = static_cast<int32>(SubjectPaths.size());
+		const int32 NumOperands = static_cast<int32>(OperandPaths.size());
+		const int32 NumPaths = NumSubjects + NumOperands;
+
+		// Per-path bounds for the tile broad phase
+		TArray<PCGExClipper2Lib::Rect64> PathBounds;
+		PathBounds.SetNumUninitialized(NumPaths);
+		ParallelFor(
+			NumPaths, [&](const int32 i)
+			{
+				PathBounds[i] = i < NumSubjects ? PCGExClipper2Lib::GetBounds(SubjectPaths[i]) : PCGExClipper2Lib::GetBounds(OperandPaths[i - NumSubjects]);
+			});
+
+		PCGExClipper2Lib::Rect64 Bounds = PCGExClipper2Lib::Rect64::InvalidRect();
+		for (const PCGExClipper2Lib::Rect64& B : PathBounds)
+		{
+			Bounds.left = FMath::Min(Bounds.left, B.left);
+			Bounds.top = FMath::Min(Bounds.top, B.top);
+			Bounds.right = FMath::Max(Bounds.right, B.right);
+			Bounds.bottom = FMath::Max(Bounds.bottom, B.bottom);
+		}
+
+		// Pad bounds so outer tile corners never touch geometry
+		Bounds.left -= 1;
+		Bounds.top -= 1;
+		Bounds.right += 1;
+		Bounds.bottom += 1;
+
+		const int32 TilesPerAxis = FMath::Clamp(
+			FMath::CeilToInt32(FMath::Sqrt(static_cast<double>(NumPaths) / static_cast<double>(FMath::Max(2, InSettings->ParallelUnionLeafSize)))),
+			2, FMath::Max(2, InSettings->MaxTilesPerAxis));
+
+		// Seams avoid every input vertex coordinate, so a seam-tagged output vertex is never a genuine one
+		TArray<int64> SeamsX;
+		TArray<int64> SeamsY;
+
+		{
+			TArray<int64> UsedCoordinates;
+			Internal::GatherCoordinates(SubjectPaths, OperandPaths, false, UsedCoordinates);
+			Internal::ComputeSeams(Bounds.left, Bounds.right, TilesPerAxis, UsedCoordinates, SeamsX);
+			Internal::GatherCoordinates(SubjectPaths, OperandPaths, true, UsedCoordinates);
+			Internal::ComputeSeams(Bounds.top, Bounds.bottom, TilesPerAxis, UsedCoordinates, SeamsY);
+		}
+
+		const int64_t SeamZ = static_cast<int64_t>(PCGEx::H64(SEAM_MARKER, SEAM_MARKER));
+		const int32 NumTiles = TilesPerAxis * TilesPerAxis;
+
+		TArray<PCGExClipper2Lib::Paths64> TileResults;
+		TileResults.SetNum(NumTiles);
+
+		std::atomic<bool> bFailed{false};
+
+		ParallelFor(
+			NumTiles, [&](const int32 TileIndex)
+			{
+				const int32 TX = TileIndex % TilesPerAxis;
+				const int32 TY = TileIndex / TilesPerAxis;
+
+				const PCGExClipper2Lib::Rect64 Tile(SeamsX[TX], SeamsY[TY], SeamsX[TX + 1], SeamsY[TY + 1]);
+				if (Tile.Width() <= 0 || Tile.Height() <= 0) { return; }
+
+				// Only paths overlapping the tile can affect the fill within it
+				PCGExClipper2Lib::Paths64 TileSubjects;
+				PCGExClipper2Lib::Paths64 TileOperands;
+				for (int32 i = 0; i < NumPaths; i++)
+				{
+					if (!PathBounds[i].Intersects(Tile)) { continue; }
+					if (i < NumSubjects) { TileSubjects.push_back(SubjectPaths[i]); }
+					else { TileOperands.push_back(OperandPaths[i - NumSubjects]); }
+				}
+
+				if (TileSubjects.empty() && (InClipType != PCGExClipper2Lib::ClipType::Union && InClipType != PCGExClipper2Lib::ClipType::Xor)) { return; }
+				if (TileSubjects.empty() && TileOperands.empty()) { return; }
+
+				PCGExClipper2Lib::Paths64 LocalResult;
+				{
+					PCGExClipper2Lib::Clipper64 Clipper;
+					Clipper.SetZCallback(CreateZCallback());
+					if (!TileSubjects.empty()) { Clipper.AddSubject(TileSubjects); }
+					if (!TileOperands.empty()) { Clipper.AddClip(TileOperands); }
+					if (!Clipper.Execute(InClipType, InFillRule, LocalResult))
+					{
+						bFailed = true;
+						return;
+					}
+
+					if (LocalResult.empty()) { return; }
+				}
+
+				// Crop to the tile; seam vertices are tagged so they can be recognized in the ZCallback & stripped after stitching
+				PCGExClipper2Lib::Path64 TilePath = Tile.AsPath();
+				for (PCGExClipper2Lib::Point64& Pt : TilePath) { Pt.z = SeamZ; }
+
+				PCGExClipper2Lib::Clipper64 Clipper;
+				Clipper.SetZCallback(CreateZCallback());
+				Clipper.AddSubject(LocalResult);
+				Clipper.AddClip(PCGExClipper2Lib::Paths64{TilePath});
+				if (!Clipper.Execute(PCGExClipper2Lib::ClipType::Intersection, PCGExClipper2Lib::FillRule::NonZero, TileResults[TileIndex])) { bFailed = true; }
+			});
+
+		if (bFailed) { return false; }
+
+		// Stitch tiles back together; pieces only share seam edges so the union dissolves them
+		OutClosed.clear();
+		for (PCGExClipper2Lib::Paths64& TileResult : TileResults)
+		{
+			for (PCGExClipper2Lib::Path64& Path : TileResult) { OutClosed.push_back(MoveTemp(Path)); }
+		}
+
+		// Tile results are already oriented, with signed holes
+		if (!UnionInPlace(OutClosed, InSettings->ParallelUnionLeafSize)) { return false; }
+
+		// Remove any leftover seam vertex (tile corners landing exactly on an output boundary).
+		// Seam lines avoid input vertices, so these can only lie along an input edge and never carry a genuine corner.
+		for (PCGExClipper2Lib::Path64& Path : OutClosed)
+		{
+			Path.erase(std::remove_if(Path.begin(), Path.end(), [](const PCGExClipper2Lib::Point64& Pt) { return Internal::IsSeam(Pt); }), Path.end());
+		}
+
+		OutClosed.erase(std::remove_if(OutClosed.begin(), OutClosed.end(), [](const PCGExClipper2Lib::Path64& Path) { return Path.size() < 3; }), OutClosed.end());
+
+		return true;
 	}
 
 	void FProcessingGroup::AddIntersectionBlendInfo(int64_t X, int64_t Y, const FIntersectionBlendInfo& Info)
 	{
-		const uint64 Key = PCGEx::H64(static_cast<uint32>(X & 0xFFFFFFFF), static_cast<uint32>(Y & 0xFFFFFFFF));
 		FScopeLock Lock(&IntersectionLock);
-		IntersectionBlendInfos.Add(Key, Info);
+		if (!SharedIntersections) { SharedIntersections = PendingIntersections.Add_GetRef(MakeShared<FIntersectionBuffer>(64)); }
+		SharedIntersections->Add(X, Y, Info);
+	}
+
+	void FProcessingGroup::FreezeIntersections()
+	{
+		if (PendingIntersections.IsEmpty()) { return; }
+
+		TRACE_CPUPROFILER_EVENT_SCOPE(FProcessingGroup::FreezeIntersections)
+
+		int32 NumRecords = IntersectionKeys.Num();
+		for (const TSharedPtr<FIntersectionBuffer>& Buffer : PendingIntersections) { NumRecords += Buffer->Keys.Num(); }
+
+		// Flatten existing & pending entries; order of appearance is preserved so later entries win, like a map insertion would
+		TArray<PCGEx::FIndexKey> Order;
+		Order.Reserve(NumRecords);
+
+		TArray<FIntersectionBlendInfo> AllInfos;
+		AllInfos.Reserve(NumRecords);
+
+		for (int32 i = 0; i < IntersectionKeys.Num(); i++) { Order.Emplace(AllInfos.Add(IntersectionBlendInfos[i]), IntersectionKeys[i]); }
+		for (const TSharedPtr<FIntersectionBuffer>& Buffer : PendingIntersections)
+		{
+			for (int32 i = 0; i < Buffer->Keys.Num(); i++) { Order.Emplace(AllInfos.Add(Buffer->Infos[i]), Buffer->Keys[i]); }
+		}
+
+		PendingIntersections.Empty();
+		SharedIntersections.Reset();
+
+		Order.Sort([](const PCGEx::FIndexKey& A, const PCGEx::FIndexKey& B) { return A.Key == B.Key ? A.Index < B.Index : A.Key < B.Key; });
+
+		IntersectionKeys.Reset(NumRecords);
+		IntersectionBlendInfos.Reset(NumRecords);
+
+		for (int32 i = 0; i < Order.Num(); i++)
+		{
+			// Keep the last entry for any given key
+			if (i + 1 < Order.Num() && Order[i + 1].Key == Order[i].Key) { continue; }
+			IntersectionKeys.Add(Order[i].Key);
+			IntersectionBlendInfos.Add(AllInfos[Order[i].Index]);
+		}
 	}
 
 	const FIntersectionBlendInfo* FProcessingGroup::GetIntersectionBlendInfo(int64_t X, int64_t Y) const
 	{
-		const uint64 Key = PCGEx::H64(static_cast<uint32>(X & 0xFFFFFFFF), static_cast<uint32>(Y & 0xFFFFFFFF));
-		return IntersectionBlendInfos.Find(Key);
+		const uint64 Key = GetIntersectionKey(X, Y);
+		const int32 Index = Algo::LowerBound(IntersectionKeys, Key);
+		return IntersectionKeys.IsValidIndex(Index) && IntersectionKeys[Index] == Key ? &IntersectionBlendInfos[Index] : nullptr;
 	}
 
-	PCGExClipper2Lib::ZCallback64 FProcessingGroup::CreateZCallback()
+	PCGExClipper2Lib::ZCallback64 FProcessingGroup::CreateZCallback(const int32 InReserve)
 	{
-		TWeakPtr<FProcessingGroup> WeakSelf = AsWeak();
+		// Register the capture buffer once, so the callback itself never locks.
+		// The callback shares ownership of the buffer: FreezeIntersections drops the group's reference, and a
+		// callback invoked after that must not write into freed memory.
+		TSharedPtr<FIntersectionBuffer> Buffer;
+
+		{
+			FScopeLock Lock(&IntersectionLock);
+			Buffer = PendingIntersections.Add_GetRef(MakeShared<FIntersectionBuffer>(InReserve));
+		}
 
-		return [WeakSelf](
+		return [Buffer](
 			const PCGExClipper2Lib::Point64& e1bot, const PCGExClipper2Lib::Point64& e1top,
 			const PCGExClipper2Lib::Point64& e2bot, const PCGExClipper2Lib::Point64& e2top,
 			PCGExClipper2Lib::Point64& pt)
 		{
-			TSharedPtr<FProcessingGroup> Group = WeakSelf.Pin();
-			if (!Group) { return; }
+			// Crossing a tile seam; the point sits on the other edge only
+			const bool bE1Seam = Internal::IsSeam(e1bot) && Internal::IsSeam(e1top);
+			const bool bE2Seam = Internal::IsSeam(e2bot) && Internal::IsSeam(e2top);
+
+			if (bE1Seam && bE2Seam)
+			{
+				pt.z = static_cast<int64_t>(PCGEx::H64(SEAM_MARKER, SEAM_MARKER));
+				return;
+			}
+
+			if (bE1Seam || bE2Seam)
+			{
+				const PCGExClipper2Lib::Point64& Bot = bE1Seam ? e2bot : e1bot;
+				const PCGExClipper2Lib::Point64& Top = bE1Seam ? e2top : e1top;
+
+				uint32 BotPtIdx, BotSrcIdx, TopPtIdx, TopSrcIdx;
+				PCGEx::H64(static_cast<uint64>(Bot.z), BotPtIdx, BotSrcIdx);
+				PCGEx::H64(static_cast<uint64>(Top.z), TopPtIdx, TopSrcIdx);
+
+				const double DX = static_cast<double>(Top.x - Bot.x);
+				const double DY = static_cast<double>(Top.y - Bot.y);
+				const double LenSq = DX * DX + DY * DY;
+				const double Alpha = LenSq < SMALL_NUMBER ? 0.5 : FMath::Clamp((static_cast<double>(pt.x - Bot.x) * DX + static_cast<double>(pt.y - Bot.y) * DY) / LenSq, 0.0, 1.0);
+
+				FIntersectionBlendInfo Info;
+				Info.E1BotPointIdx = Info.E2BotPointIdx = BotPtIdx;
+				Info.E1BotSourceIdx = Info.E2BotSourceIdx = BotSrcIdx;
+				Info.E1TopPointIdx = Info.E2TopPointIdx = TopPtIdx;
+				Info.E1TopSourceIdx = Info.E2TopSourceIdx = TopSrcIdx;
+				Info.E1Alpha = Info.E2Alpha = Alpha;
+
+				Buffer->Add(pt.x, pt.y, Info);
+				pt.z = static_cast<int64_t>(PCGEx::H64(INTERSECTION_MARKER, INTERSECTION_MARKER));
+				return;
+			}
 
 			// Decode the source info from each vertex
 			uint32 E1BotPtIdx, E1BotSrcIdx;
@@ -167,7 +590,7 @@ namespace PCGExClipper2
 			Info.E2Alpha = CalcAlpha(e2bot, e2top, pt);
 
 			// Store intersection info
-			Group->AddIntersectionBlendInfo(pt.x, pt.y, Info);
+			Buffer->Add(pt.x, pt.y, Info);
 
 			// Encode intersection marker in Z - use a special pattern
 			// We mark it as an intersection point; the actual blend info is stored in the map
@@ -308,6 +731,9 @@ void FPCGExClipper2ProcessorContext::OutputPaths64(
 
 	if (InPaths.empty()) { return; }
 
+	// All executions feeding these paths are complete; lookups below run against the frozen table
+	Group->FreezeIntersections();
+
 	const double InvScale = 1.0 / static_cast<double>(Settings->Precision);
 
 	TArray<int8> VisitedSources;
@@ -944,7 +1370,12 @@ bool FPCGExClipper2ProcessorElement::AdvanceWork(FPCGExContext* InContext, const
 				if (!SharedContext.Get()) { return; }
 
 				const TSharedPtr<PCGExClipper2::FProcessingGroup> Group = SharedContext.Get()->ProcessingGroups[Index];
-				Group->PreProcess(Settings);
+				if (!Group->PreProcess(Settings))
+				{
+					PCGE_LOG_C(Warning, GraphAndLog, SharedContext.Get(), FTEXT("Union before operation failed, group skipped."));
+					return;
+				}
+
 				SharedContext.Get()->Process(Group);
 			});
 		}
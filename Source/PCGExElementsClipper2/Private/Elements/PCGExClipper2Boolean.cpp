@@ -66,18 +66,6 @@ void FPCGExClipper2BooleanContext::Process(const TSharedPtr<PCGExClipper2::FProc
 
 	if (!Group->IsValid()) { return; }
 
-	// Create clipper and set up ZCallback for intersection tracking
-	PCGExClipper2Lib::Clipper64 Clipper;
-	Clipper.SetZCallback(Group->CreateZCallback());
-
-	// Add subject paths
-	if (!Group->SubjectPaths.empty()) { Clipper.AddSubject(Group->SubjectPaths); }
-	if (!Group->OpenSubjectPaths.empty()) { Clipper.AddOpenSubject(Group->OpenSubjectPaths); }
-
-	// Add operand paths as clips if available
-	if (!Group->OperandPaths.empty()) { Clipper.AddClip(Group->OperandPaths); }
-	if (!Group->OpenOperandPaths.empty()) { Clipper.AddClip(Group->OpenOperandPaths); }
-
 	// Determine clip type
 	PCGExClipper2Lib::ClipType ClipType;
 	switch (Settings->Operation)
@@ -103,7 +91,7 @@ void FPCGExClipper2BooleanContext::Process(const TSharedPtr<PCGExClipper2::FProc
 	PCGExClipper2Lib::Paths64 ClosedResults;
 	PCGExClipper2Lib::Paths64 OpenResults;
 
-	if (!Clipper.Execute(ClipType, PCGExClipper2::ConvertFillRule(Settings->FillRule), ClosedResults, OpenResults)) { return; }
+	if (!Group->ExecuteBoolean(Settings, ClipType, PCGExClipper2::ConvertFillRule(Settings->FillRule), ClosedResults, OpenResults)) { return; }
 
 	if (!ClosedResults.empty())
 	{
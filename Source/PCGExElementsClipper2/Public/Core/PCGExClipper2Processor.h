@@ -112,6 +112,9 @@ namespace PCGExClipper2
 	// Special marker for intersection points - uses high bit pattern that's unlikely in normal usage
 	constexpr uint32 INTERSECTION_MARKER = 0xFFFFFFFF;
 
+	// Marker for tile boundary vertices used during tiled execution; never survives to the output
+	constexpr uint32 SEAM_MARKER = 0xFFFFFFFE;
+
 	/** Controls how output transforms are computed */
 	enum class ETransformRestoration : uint8
 	{
@@ -141,6 +144,33 @@ namespace PCGExClipper2
 		double E2Alpha = 0.5;
 	};
 
+	FORCEINLINE static uint64 GetIntersectionKey(const int64_t X, const int64_t Y)
+	{
+		return PCGEx::H64(static_cast<uint32>(X & 0xFFFFFFFF), static_cast<uint32>(Y & 0xFFFFFFFF));
+	}
+
+	/**
+	 * Append-only intersection capture, owned by a single Clipper execution.
+	 * Written without synchronization from within the ZCallback, and merged into the group table once the execution is complete.
+	 */
+	struct PCGEXELEMENTSCLIPPER2_API FIntersectionBuffer
+	{
+		TArray<uint64> Keys;
+		TArray<FIntersectionBlendInfo> Infos;
+
+		explicit FIntersectionBuffer(const int32 InReserve)
+		{
+			Keys.Reserve(InReserve);
+			Infos.Reserve(InReserve);
+		}
+
+		FORCEINLINE void Add(const int64_t X, const int64_t Y, const FIntersectionBlendInfo& Info)
+		{
+			Keys.Add(GetIntersectionKey(X, Y));
+			Infos.Add(Info);
+		}
+	};
+
 	class PCGEXELEMENTSCLIPPER2_API FOpData : public TSharedFromThis<FOpData>
 	{
 	public:
@@ -182,27 +212,56 @@ namespace PCGExClipper2
 		TArray<int32> AllSourceIndices;
 		TSharedPtr<PCGExData::FTags> GroupTags;
 
-		// Intersection blend info map: keyed by encoded (x,y) position
-		TMap<uint64, FIntersectionBlendInfo> IntersectionBlendInfos;
+		// Per-execution capture buffers, pending freeze
+		TArray<TSharedPtr<FIntersectionBuffer>> PendingIntersections;
+		TSharedPtr<FIntersectionBuffer> SharedIntersections;
 		mutable FCriticalSection IntersectionLock;
 
+		// Frozen intersection table: keyed by encoded (x,y) position, sorted by key
+		TArray<uint64> IntersectionKeys;
+		TArray<FIntersectionBlendInfo> IntersectionBlendInfos;
+
 		FProcessingGroup() = default;
 
 		// Prepare cached paths from AllOpData
 		void Prepare(const TSharedPtr<FOpData>& AllOpData);
-		void PreProcess(const UPCGExClipper2ProcessorSettings* InSettings);
+		bool PreProcess(const UPCGExClipper2ProcessorSettings* InSettings);
 
 		// Check if this group is valid for processing
 		bool IsValid() const { return !SubjectPaths.empty() || !OpenSubjectPaths.empty(); }
 
-		// Add intersection blend info (thread-safe)
+		// Union paths in-place (NonZero). When LeafSize is > 0 and there are enough paths,
+		// paths are spatially ordered, unioned in parallel subsets and merged pairwise; only pass a LeafSize for
+		// inputs where that is equivalent to a single execution (same-signed paths, or disjoint oriented results).
+		// Returns false if any Clipper execution failed.
+		bool UnionInPlace(PCGExClipper2Lib::Paths64& InOutPaths, int32 LeafSize = 0);
+
+		// Execute a boolean operation on the cached subject & operand paths,
+		// routing through parallel union or tiled execution when enabled and applicable.
+		bool ExecuteBoolean(
+			const UPCGExClipper2ProcessorSettings* InSettings,
+			PCGExClipper2Lib::ClipType InClipType, PCGExClipper2Lib::FillRule InFillRule,
+			PCGExClipper2Lib::Paths64& OutClosed, PCGExClipper2Lib::Paths64& OutOpen);
+
+		// Add intersection blend info outside of a ZCallback (thread-safe, takes a lock; prefer CreateZCallback for hot paths)
 		void AddIntersectionBlendInfo(int64_t X, int64_t Y, const FIntersectionBlendInfo& Info);
 
-		// Get intersection blend info by position
+		// Merge pending capture buffers into the sorted lookup table.
+		// Must be called once executions are complete and before any GetIntersectionBlendInfo; not thread-safe.
+		void FreezeIntersections();
+
+		// Get intersection blend info by position, from the frozen table
 		const FIntersectionBlendInfo* GetIntersectionBlendInfo(int64_t X, int64_t Y) const;
 
-		// Create the ZCallback for this group
-		PCGExClipper2Lib::ZCallback64 CreateZCallback();
+		// Create the ZCallback for a single Clipper execution. Each callback owns its own capture buffer,
+		// so executions can safely run in parallel.
+		PCGExClipper2Lib::ZCallback64 CreateZCallback(int32 InReserve = 256);
+
+	protected:
+		bool ExecuteTiled(
+			const UPCGExClipper2ProcessorSettings* InSettings,
+			PCGExClipper2Lib::ClipType InClipType, PCGExClipper2Lib::FillRule InFillRule,
+			PCGExClipper2Lib::Paths64& OutClosed);
 	};
 }
 
@@ -305,6 +364,28 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Output|Flags", EditFixedSize, meta = (ReadOnlyKeys, DisplayName=" └─ Mapping", EditCondition="bFlagJoints", HideEditConditionToggle))
 	TMap<EPCGExClipper2EndpointType, int32> JointTypeValueMapping;
 
+	/** If enabled, unions over many paths are split into spatially coherent subsets that are unioned in parallel then merged pairwise.
+	 * Only applies to Non-Zero unions; may change the starting point of output paths. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Performance, meta=(PCG_NotOverridable, AdvancedDisplay))
+	bool bParallelUnion = false;
+
+	/** Number of paths per subset when performing parallel union. Also drives the number of tiles used by tiled operations. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Performance, meta=(PCG_NotOverridable, AdvancedDisplay, EditCondition="bParallelUnion || bTileLargeOperations", ClampMin=2))
+	int32 ParallelUnionLeafSize = 256;
+
+	/** If enabled, boolean operations on groups with many closed paths are split into a grid of tiles processed in parallel, then stitched back together.
+	 * Groups containing open paths are never tiled. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Performance, meta=(PCG_NotOverridable, AdvancedDisplay))
+	bool bTileLargeOperations = false;
+
+	/** Minimum number of closed paths (subjects + operands) in a group before tiling kicks in. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Performance, meta=(PCG_NotOverridable, AdvancedDisplay, EditCondition="bTileLargeOperations", ClampMin=2))
+	int32 TilingThreshold = 2048;
+
+	/** Maximum number of tiles along each axis. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Performance, meta=(PCG_NotOverridable, AdvancedDisplay, EditCondition="bTileLargeOperations", ClampMin=2))
+	int32 MaxTilesPerAxis = 8;
+
 	/** (DEBUG) If enabled, performs a union of all paths in the group before proceeding to the operation */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_NotOverridable), AdvancedDisplay)
 	bool bUnionGroupBeforeOperation = false;
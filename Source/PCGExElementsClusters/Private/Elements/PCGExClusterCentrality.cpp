@@ -34,7 +34,7 @@ void UPCGExClusterCentralitySettings::ApplyDeprecation(UPCGNode* InOutNode)
 bool UPCGExClusterCentralitySettings::IsPinUsedByNodeExecution(const UPCGPin* InPin) const
 {
 	if (InPin->Properties.Label == PCGExClusters::Labels::SourceVtxFiltersLabel) { return IsPathBased() && DownsamplingMode == EPCGExCentralityDownsampling::Filters; }
-	if (InPin->Properties.Label == PCGExHeuristics::Labels::SourceHeuristicsLabel) { return IsPathBased(); }
+	if (InPin->Properties.Label == PCGExHeuristics::Labels::SourceHeuristicsLabel) { return UsesHeuristics(); }
 	return Super::IsPinUsedByNodeExecution(InPin);
 }
 
@@ -42,7 +42,7 @@ TArray<FPCGPinProperties> UPCGExClusterCentralitySettings::InputPinProperties()
 {
 	TArray<FPCGPinProperties> PinProperties = Super::InputPinProperties();
 
-	if (IsPathBased())
+	if (UsesHeuristics())
 	{
 		PCGEX_PIN_FACTORIES(PCGExHeuristics::Labels::SourceHeuristicsLabel, "Heuristics.", Required, FPCGExDataTypeInfoHeuristics::AsId())
 	}
@@ -89,7 +89,7 @@ bool FPCGExClusterCentralityElement::AdvanceWork(FPCGExContext* InContext, const
 	{
 		if (!Context->StartProcessingClusters([](const TSharedPtr<PCGExData::FPointIOTaggedEntries>& Entries) { return true; }, [&](const TSharedPtr<PCGExClusterMT::IBatch>& NewBatch)
 		{
-			if (Settings->IsPathBased())
+			if (Settings->UsesHeuristics())
 			{
 				NewBatch->SetWantsHeuristics(true, Settings->HeuristicScoreMode);
 			}
@@ -154,19 +154,35 @@ namespace PCGExClusterCentrality
 		}
 
 		// Path-based types: need edge scores + optional downsampling
+		bMultiSource = Settings->bUnweighted && Settings->CentralityType != EPCGExCentralityType::Betweenness;
+		bAdaptive = Settings->DownsamplingMode == EPCGExCentralityDownsampling::Adaptive && Settings->CentralityType == EPCGExCentralityType::Betweenness;
+
+		// Unit-length edges, no edge scores to wait for
+		if (Settings->bUnweighted) { bEdgeComplete = true; }
+
 		bDownsample = Settings->DownsamplingMode != EPCGExCentralityDownsampling::None;
 		if (bDownsample)
 		{
-			if (Settings->DownsamplingMode == EPCGExCentralityDownsampling::Ratio)
-			{
-				Settings->RandomDownsampling.GetPicks(Context, VtxDataFacade->GetIn(), NumNodes, RandomSamples);
-			}
-			else
+			if (Settings->DownsamplingMode == EPCGExCentralityDownsampling::Filters)
 			{
 				PCGExArrayHelpers::ArrayOfIndices(RandomSamples, NumNodes);
 				bVtxComplete = false;
 				StartParallelLoopForNodes();
 			}
+			else
+			{
+				// Picks come out shuffled, so adaptive sampling can draw them in order
+				Settings->RandomDownsampling.GetPicks(Context, VtxDataFacade->GetIn(), NumNodes, RandomSamples);
+			}
+		}
+
+		if (bAdaptive) { SampledSquares.Init(0.0, NumNodes); }
+
+		if (Settings->bUnweighted)
+		{
+			// With filters, node processing completion starts the compute
+			if (Settings->DownsamplingMode != EPCGExCentralityDownsampling::Filters) { TryStartCompute(); }
+			return true;
 		}
 
 		DirectedEdgeScores.SetNum(NumEdges * 2);
@@ -238,30 +254,89 @@ namespace PCGExClusterCentrality
 
 		if (bDownsample && RandomSamples.IsEmpty()) { RandomSamples.Add(0); }
 
-		StartParallelLoopForRange(bDownsample ? RandomSamples.Num() : NumNodes, 128);
+		if (bMultiSource)
+		{
+			StartParallelLoopForRange(FMath::DivideAndRoundUp(GetNumSources(), NumLanes), 1);
+			return;
+		}
+
+		if (bAdaptive)
+		{
+			StartAdaptiveRound();
+			return;
+		}
+
+		StartParallelLoopForRange(GetNumSources(), 128);
+	}
+
+	void FProcessor::StartAdaptiveRound()
+	{
+		// Geometric schedule : each round grows the sample by half, so convergence is only checked a logarithmic number of times
+		AdaptiveRoundSize = FMath::Min(RandomSamples.Num() - AdaptiveCursor, FMath::Max(NumLanes, AdaptiveCursor / 2));
+
+		// Keep the number of scopes close to the number of workers, each scope holds two node-sized arrays
+		const int32 NumWorkers = FMath::Max(1, FTaskGraphInterface::Get().GetNumWorkerThreads());
+		StartParallelLoopForRange(AdaptiveRoundSize, FMath::Max(16, FMath::DivideAndRoundUp(AdaptiveRoundSize, NumWorkers * 2)));
+	}
+
+	bool FProcessor::IsAdaptiveConverged() const
+	{
+		// Empirical Bernstein bound on each node's mean per-source dependency,
+		// normalized to [0,1] by the largest possible dependency (N - 2), at 90% confidence per node.
+		const double K = AdaptiveCursor;
+		const double Norm = 1.0 / FMath::Max(1, NumNodes - 2);
+		const double LogTerm = FMath::Loge(3.0 / 0.1);
+		const double RangeTerm = 3.0 * LogTerm / K;
+
+		double MaxMean = 0;
+		double MaxError = 0;
+
+		for (int32 i = 0; i < NumNodes; i++)
+		{
+			const double Mean = CentralityScores[i] * Norm / K;
+			const double Variance = FMath::Max(0.0, SampledSquares[i] * Norm * Norm / K - Mean * Mean);
+			MaxMean = FMath::Max(MaxMean, Mean);
+			MaxError = FMath::Max(MaxError, FMath::Sqrt(2.0 * Variance * LogTerm / K) + RangeTerm);
+		}
+
+		return MaxError <= Settings->AdaptiveErrorBound * MaxMean;
 	}
 
 	void FProcessor::PrepareLoopScopesForRanges(const TArray<PCGExMT::FScope>& Loops)
 	{
+		// Multi-source batches write their sources' scores directly
+		if (bMultiSource) { return; }
+
 		ScopedCentralityScores = MakeShared<PCGExMT::TScopedArray<double>>(Loops);
+		if (bAdaptive) { ScopedCentralitySquares = MakeShared<PCGExMT::TScopedArray<double>>(Loops); }
 	}
 
 	void FProcessor::ProcessRange(const PCGExMT::FScope& Scope)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExClusterCentrality::ProcessRange);
 
+		if (bMultiSource)
+		{
+			const TSharedPtr<FMultiSourceBFS> State = AcquireBFSState();
+			PCGEX_SCOPE_LOOP(Index) { ProcessBatch_MultiSourceBFS(Index, *State); }
+			ReleaseBFSState(State);
+			return;
+		}
+
 		TArray<double>& LocalScores = ScopedCentralityScores->Get_Ref(Scope);
 		LocalScores.Init(0.0, NumNodes);
 
-		TArray<double> Score;
-		Score.Init(DBL_MAX, NumNodes);
-
-		TArray<int32> Stack;
-		Stack.Reserve(NumNodes);
+		// Adaptive rounds index into the next slice of the shuffled samples
+		const int32 Offset = bAdaptive ? AdaptiveCursor : 0;
 
-		TSharedPtr<PCGEx::FScoredQueue> Queue = MakeShared<PCGEx::FScoredQueue>(NumNodes);
+		TArray<double>* LocalSquares = nullptr;
+		if (bAdaptive)
+		{
+			LocalSquares = &ScopedCentralitySquares->Get_Ref(Scope);
+			LocalSquares->Init(0.0, NumNodes);
+		}
 
-		if (Settings->CentralityType == EPCGExCentralityType::Betweenness)
+		if (Settings->CentralityType == EPCGExCentralityType::Betweenness && Settings->bUnweighted)
 		{
 			TArray<double> Sigma;
 			Sigma.Init(0.0, NumNodes);
@@ -269,72 +344,70 @@ namespace PCGExClusterCentrality
 			TArray<double> Delta;
 			Delta.Init(0.0, NumNodes);
 
-			TArray<NodePred> Pred;
-			Pred.SetNum(NumNodes);
+			TArray<int32> Depth;
+			Depth.Init(-1, NumNodes);
 
-			if (bDownsample)
-			{
-				PCGEX_SCOPE_LOOP(Index)
-				{
-					ProcessSingleNode_Betweenness(RandomSamples[Index], LocalScores, Score, Sigma, Delta, Pred, Stack, Queue);
-				}
+			TArray<int32> Queue;
+			Queue.Reserve(NumNodes);
 
-				const double Ratio = static_cast<double>(NumNodes) / static_cast<double>(RandomSamples.Num());
-				for (double& B : LocalScores) { B *= Ratio; }
-			}
-			else
+			PCGEX_SCOPE_LOOP(Index)
 			{
-				PCGEX_SCOPE_LOOP(Index)
-				{
-					ProcessSingleNode_Betweenness(Index, LocalScores, Score, Sigma, Delta, Pred, Stack, Queue);
-				}
+				ProcessSingleNode_BetweennessBFS(GetSource(Offset + Index), LocalScores, LocalSquares, Depth, Sigma, Delta, Queue);
 			}
 		}
-		else if (Settings->CentralityType == EPCGExCentralityType::Closeness)
+		else
 		{
-			if (bDownsample)
-			{
-				PCGEX_SCOPE_LOOP(Index)
-				{
-					ProcessSingleNode_Closeness(RandomSamples[Index], LocalScores, Score, Stack, Queue);
-				}
+			TArray<double> Score;
+			Score.Init(DBL_MAX, NumNodes);
 
-				const double Ratio = static_cast<double>(NumNodes) / static_cast<double>(RandomSamples.Num());
-				for (double& B : LocalScores) { B *= Ratio; }
-			}
-			else
+			TArray<int32> Stack;
+			Stack.Reserve(NumNodes);
+
+			TSharedPtr<PCGEx::FScoredQueue> Queue = MakeShared<PCGEx::FScoredQueue>(NumNodes);
+
+			if (Settings->CentralityType == EPCGExCentralityType::Betweenness)
 			{
+				TArray<double> Sigma;
+				Sigma.Init(0.0, NumNodes);
+
+				TArray<double> Delta;
+				Delta.Init(0.0, NumNodes);
+
+				TArray<NodePred> Pred;
+				Pred.SetNum(NumNodes);
+
 				PCGEX_SCOPE_LOOP(Index)
 				{
-					ProcessSingleNode_Closeness(Index, LocalScores, Score, Stack, Queue);
+					ProcessSingleNode_Betweenness(GetSource(Offset + Index), LocalScores, LocalSquares, Score, Sigma, Delta, Pred, Stack, Queue);
 				}
 			}
-		}
-		else if (Settings->CentralityType == EPCGExCentralityType::HarmonicCloseness)
-		{
-			if (bDownsample)
+			else if (Settings->CentralityType == EPCGExCentralityType::Closeness)
 			{
 				PCGEX_SCOPE_LOOP(Index)
 				{
-					ProcessSingleNode_HarmonicCloseness(RandomSamples[Index], LocalScores, Score, Stack, Queue);
+					ProcessSingleNode_Closeness(GetSource(Index), LocalScores, Score, Stack, Queue);
 				}
-
-				const double Ratio = static_cast<double>(NumNodes) / static_cast<double>(RandomSamples.Num());
-				for (double& B : LocalScores) { B *= Ratio; }
 			}
-			else
+			else if (Settings->CentralityType == EPCGExCentralityType::HarmonicCloseness)
 			{
 				PCGEX_SCOPE_LOOP(Index)
 				{
-					ProcessSingleNode_HarmonicCloseness(Index, LocalScores, Score, Stack, Queue);
+					ProcessSingleNode_HarmonicCloseness(GetSource(Index), LocalScores, Score, Stack, Queue);
 				}
 			}
 		}
+
+		// Adaptive sampling extrapolates once, after its last round
+		if (bDownsample && !bAdaptive)
+		{
+			const double Ratio = static_cast<double>(NumNodes) / static_cast<double>(RandomSamples.Num());
+			for (double& B : LocalScores) { B *= Ratio; }
+		}
 	}
 
 #pragma region ProcessSingleNode_Betweenness
 
-	void FProcessor::ProcessSingleNode_Betweenness(const int32 Index, TArray<double>& LocalScores, TArray<double>& Score, TArray<double>& Sigma, TArray<double>& Delta, TArray<NodePred>& Pred, TArray<int32>& Stack, const TSharedPtr<PCGEx::FScoredQueue>& Queue)
+	void FProcessor::ProcessSingleNode_Betweenness(const int32 Index, TArray<double>& LocalScores, TArray<double>* LocalSquares, TArray<double>& Score, TArray<double>& Sigma, TArray<double>& Delta, TArray<NodePred>& Pred, TArray<int32>& Stack, const TSharedPtr<PCGEx::FScoredQueue>& Queue)
 	{
 		Stack.Reset();
 
@@ -382,7 +455,11 @@ namespace PCGExClusterCentrality
 		{
 			const int32 W = Stack[i];
 			for (const int32 V : Pred[W]) { Delta[V] += (Sigma[V] / Sigma[W]) * (1.0 + Delta[W]); }
-			if (W != Index) { LocalScores[W] += Delta[W]; }
+			if (W != Index)
+			{
+				LocalScores[W] += Delta[W];
+				if (LocalSquares) { (*LocalSquares)[W] += Delta[W] * Delta[W]; }
+			}
 		}
 
 		// Reset only visited nodes (optimization: O(visited) instead of O(N))
@@ -510,6 +587,191 @@ namespace PCGExClusterCentrality
 
 #pragma endregion
 
+#pragma region ProcessSingleNode_BetweennessBFS
+
+	void FProcessor::ProcessSingleNode_BetweennessBFS(const int32 Index, TArray<double>& LocalScores, TArray<double>* LocalSquares, TArray<int32>& Depth, TArray<double>& Sigma, TArray<double>& Delta, TArray<int32>& Queue)
+	{
+		// Unit-length Brandes : a FIFO queue replaces the priority queue, and predecessors are
+		// recovered from depths during accumulation instead of being stored.
+		const TArray<PCGExClusters::FNode>& Nodes = *Cluster->Nodes.Get();
+
+		Queue.Reset();
+		Queue.Add(Index);
+
+		Depth[Index] = 0;
+		Sigma[Index] = 1.0;
+
+		for (int32 Head = 0; Head < Queue.Num(); Head++)
+		{
+			const int32 V = Queue[Head];
+			const int32 NextDepth = Depth[V] + 1;
+
+			for (const PCGExGraphs::FLink Lk : Nodes[V].Links)
+			{
+				const int32 W = Lk.Node;
+
+				if (Depth[W] < 0)
+				{
+					Depth[W] = NextDepth;
+					Queue.Add(W);
+				}
+
+				if (Depth[W] == NextDepth) { Sigma[W] += Sigma[V]; }
+			}
+		}
+
+		// Queue is in non-decreasing depth order, walk it backward to accumulate dependencies
+		for (int32 i = Queue.Num() - 1; i >= 0; --i)
+		{
+			const int32 W = Queue[i];
+			const int32 PrevDepth = Depth[W] - 1;
+			const double Coeff = (1.0 + Delta[W]) / Sigma[W];
+
+			for (const PCGExGraphs::FLink Lk : Nodes[W].Links)
+			{
+				if (Depth[Lk.Node] == PrevDepth) { Delta[Lk.Node] += Sigma[Lk.Node] * Coeff; }
+			}
+
+			if (W != Index)
+			{
+				LocalScores[W] += Delta[W];
+				if (LocalSquares) { (*LocalSquares)[W] += Delta[W] * Delta[W]; }
+			}
+		}
+
+		for (const int32 N : Queue)
+		{
+			Depth[N] = -1;
+			Sigma[N] = 0;
+			Delta[N] = 0;
+		}
+	}
+
+#pragma endregion
+
+#pragma region ProcessBatch_MultiSourceBFS
+
+	TSharedPtr<FMultiSourceBFS> FProcessor::AcquireBFSState()
+	{
+		{
+			FScopeLock Lock(&BFSStatePoolLock);
+			if (!BFSStatePool.IsEmpty()) { return BFSStatePool.Pop(); }
+		}
+
+		// Pool is empty, create new state
+		return MakeShared<FMultiSourceBFS>(NumNodes);
+	}
+
+	void FProcessor::ReleaseBFSState(const TSharedPtr<FMultiSourceBFS>& State)
+	{
+		// Batches leave their state clean (masks zeroed through Touched), so it can be handed out as-is
+		FScopeLock Lock(&BFSStatePoolLock);
+		BFSStatePool.Add(State);
+	}
+
+	void FProcessor::ProcessBatch_MultiSourceBFS(const int32 BatchIndex, FMultiSourceBFS& State)
+	{
+		// MS-BFS : up to 64 sources share a single traversal, one bit per source in each node's masks.
+		// A node is expanded once per distinct depth it is reached at, for all lanes reaching it at that depth.
+		const TArray<PCGExClusters::FNode>& Nodes = *Cluster->Nodes.Get();
+
+		const int32 NumSources = GetNumSources();
+		const int32 First = BatchIndex * NumLanes;
+		const int32 Lanes = FMath::Min(NumLanes, NumSources - First);
+
+		int32 Sources[NumLanes];
+		int32 LevelCount[NumLanes];
+		int64 Reached[NumLanes];
+		double SumDist[NumLanes];
+		double Harmonic[NumLanes];
+
+		FMemory::Memzero(LevelCount);
+		FMemory::Memzero(Reached);
+		FMemory::Memzero(SumDist);
+		FMemory::Memzero(Harmonic);
+
+		State.Frontier.Reset();
+		State.Touched.Reset();
+
+		for (int32 L = 0; L < Lanes; L++)
+		{
+			const int32 Source = GetSource(First + L);
+			const uint64 Bit = static_cast<uint64>(1) << L;
+
+			Sources[L] = Source;
+
+			if (!State.Seen[Source])
+			{
+				State.Touched.Add(Source);
+				State.Frontier.Add(Source);
+			}
+
+			State.Seen[Source] |= Bit;
+			State.Visit[Source] |= Bit;
+		}
+
+		int32 Depth = 0;
+		while (!State.Frontier.IsEmpty())
+		{
+			Depth++;
+			State.NextFrontier.Reset();
+
+			for (const int32 V : State.Frontier)
+			{
+				const uint64 Mask = State.Visit[V];
+				State.Visit[V] = 0;
+
+				for (const PCGExGraphs::FLink Lk : Nodes[V].Links)
+				{
+					const int32 N = Lk.Node;
+					const uint64 New = Mask & ~State.Seen[N];
+					if (!New) { continue; }
+
+					if (!State.VisitNext[N]) { State.NextFrontier.Add(N); }
+					if (!State.Seen[N]) { State.Touched.Add(N); }
+
+					State.Seen[N] |= New;
+					State.VisitNext[N] |= New;
+				}
+			}
+
+			// Count nodes first reached at this depth, per source lane
+			for (const int32 N : State.NextFrontier)
+			{
+				for (uint64 M = State.VisitNext[N]; M; M &= M - 1) { LevelCount[FMath::CountTrailingZeros64(M)]++; }
+			}
+
+			const double InvDepth = 1.0 / static_cast<double>(Depth);
+			for (int32 L = 0; L < Lanes; L++)
+			{
+				if (!LevelCount[L]) { continue; }
+				Reached[L] += LevelCount[L];
+				SumDist[L] += static_cast<double>(Depth) * LevelCount[L];
+				Harmonic[L] += LevelCount[L] * InvDepth;
+				LevelCount[L] = 0;
+			}
+
+			Swap(State.Visit, State.VisitNext);
+			Swap(State.Frontier, State.NextFrontier);
+		}
+
+		for (const int32 N : State.Touched) { State.Seen[N] = 0; }
+
+		// Sources are unique, so each batch owns the scores it writes
+		const double Ratio = bDownsample ? static_cast<double>(NumNodes) / static_cast<double>(NumSources) : 1.0;
+
+		if (Settings->CentralityType == EPCGExCentralityType::Closeness)
+		{
+			for (int32 L = 0; L < Lanes; L++) { if (SumDist[L] > 0) { CentralityScores[Sources[L]] = (static_cast<double>(Reached[L]) / SumDist[L]) * Ratio; } }
+		}
+		else
+		{
+			for (int32 L = 0; L < Lanes; L++) { CentralityScores[Sources[L]] = Harmonic[L] * Ratio; }
+		}
+	}
+
+#pragma endregion
+
 #pragma region ComputeEigenvector
 
 	void FProcessor::ComputeEigenvector()
@@ -611,13 +873,47 @@ namespace PCGExClusterCentrality
 
 	void FProcessor::OnRangeProcessingComplete()
 	{
-		ScopedCentralityScores->ForEach([&](TArray<double>& ScopedArray)
+		if (ScopedCentralityScores)
 		{
-			for (int i = 0; i < NumNodes; i++) { CentralityScores[i] += ScopedArray[i]; }
-			ScopedArray.Empty();
-		});
+			ScopedCentralityScores->ForEach([&](TArray<double>& ScopedArray)
+			{
+				if (ScopedArray.IsEmpty()) { return; }
+				for (int i = 0; i < NumNodes; i++) { CentralityScores[i] += ScopedArray[i]; }
+				ScopedArray.Empty();
+			});
+
+			ScopedCentralityScores.Reset();
+		}
 
-		ScopedCentralityScores.Reset();
+		if (ScopedCentralitySquares)
+		{
+			ScopedCentralitySquares->ForEach([&](TArray<double>& ScopedArray)
+			{
+				if (ScopedArray.IsEmpty()) { return; }
+				for (int i = 0; i < NumNodes; i++) { SampledSquares[i] += ScopedArray[i]; }
+				ScopedArray.Empty();
+			});
+
+			ScopedCentralitySquares.Reset();
+		}
+
+		BFSStatePool.Empty();
+
+		if (bAdaptive)
+		{
+			// Keep drawing until the estimate is tight enough or the sample cap is reached
+			AdaptiveCursor += AdaptiveRoundSize;
+			if (AdaptiveCursor < RandomSamples.Num() && !IsAdaptiveConverged())
+			{
+				StartAdaptiveRound();
+				return;
+			}
+
+			const double Ratio = static_cast<double>(NumNodes) / static_cast<double>(AdaptiveCursor);
+			for (double& C : CentralityScores) { C *= Ratio; }
+
+			SampledSquares.Empty();
+		}
 
 		// Normalize for undirected graphs (betweenness only)
 		if (Settings->CentralityType == EPCGExCentralityType::Betweenness)
@@ -39,7 +39,8 @@ enum class EPCGExCentralityDownsampling : uint8
 {
 	None    = 0 UMETA(DisplayName = "None", ToolTip="All connected filters must pass."),
 	Ratio   = 1 UMETA(DisplayName = "Random ratio", ToolTip="Sample using a random subset of the nodes."),
-	Filters = 2 UMETA(DisplayName = "Filters", ToolTip="Use filters to drive which nodes are added to the subset")
+	Filters = 2 UMETA(DisplayName = "Filters", ToolTip="Use filters to drive which nodes are added to the subset"),
+	Adaptive = 3 UMETA(DisplayName = "Adaptive", ToolTip="Betweenness only. Keep drawing random sources until the estimated scores reach the target error bound. Other measures use the random ratio as-is.")
 };
 
 /**
@@ -77,8 +78,12 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Settings, meta=(PCG_NotOverridable))
 	EPCGExCentralityType CentralityType = EPCGExCentralityType::Betweenness;
 
+	/** Ignore heuristics and treat every edge as unit-length. Uses BFS kernels instead of Dijkstra; closeness measures process 64 sources at once using bitset frontiers. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Settings, meta=(PCG_NotOverridable, EditCondition="CentralityType == EPCGExCentralityType::Betweenness || CentralityType == EPCGExCentralityType::Closeness || CentralityType == EPCGExCentralityType::HarmonicCloseness", EditConditionHides))
+	bool bUnweighted = false;
+
 	/** Scoring mode for combining multiple heuristics */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Settings, meta=(EditCondition="CentralityType == EPCGExCentralityType::Betweenness || CentralityType == EPCGExCentralityType::Closeness || CentralityType == EPCGExCentralityType::HarmonicCloseness", EditConditionHides))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Settings, meta=(EditCondition="!bUnweighted && (CentralityType == EPCGExCentralityType::Betweenness || CentralityType == EPCGExCentralityType::Closeness || CentralityType == EPCGExCentralityType::HarmonicCloseness)", EditConditionHides))
 	EPCGExHeuristicScoreMode HeuristicScoreMode = EPCGExHeuristicScoreMode::WeightedAverage;
 
 	/** Name of the attribute */
@@ -121,8 +126,12 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_NotOverridable, EditCondition="CentralityType == EPCGExCentralityType::Betweenness || CentralityType == EPCGExCentralityType::Closeness || CentralityType == EPCGExCentralityType::HarmonicCloseness", EditConditionHides))
 	EPCGExCentralityDownsampling DownsamplingMode = EPCGExCentralityDownsampling::None;
 
-	/** If enabled, only compute centrality on a subset of the nodes to get a rough approximation. This is useful for large clusters, or if you want to tradeoff precision for speed. */
-	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, DisplayName=" └─ Ratio", EditCondition="DownsamplingMode == EPCGExCentralityDownsampling::Ratio", EditConditionHides))
+	/** Target error of the adaptive betweenness estimate, relative to the highest score. Sampling stops once every node's confidence bound is within this tolerance. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, DisplayName=" ├─ Error Bound", EditCondition="DownsamplingMode == EPCGExCentralityDownsampling::Adaptive", EditConditionHides, ClampMin=0.001, ClampMax=1))
+	double AdaptiveErrorBound = 0.05;
+
+	/** If enabled, only compute centrality on a subset of the nodes to get a rough approximation. This is useful for large clusters, or if you want to tradeoff precision for speed. In adaptive mode, this caps the number of sources drawn. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, DisplayName=" └─ Ratio", EditCondition="DownsamplingMode == EPCGExCentralityDownsampling::Ratio || DownsamplingMode == EPCGExCentralityDownsampling::Adaptive", EditConditionHides))
 	FPCGExRandomRatioDetails RandomDownsampling;
 
 	bool IsPathBased() const
@@ -131,6 +140,8 @@ public:
 			CentralityType == EPCGExCentralityType::Closeness ||
 			CentralityType == EPCGExCentralityType::HarmonicCloseness;
 	}
+
+	bool UsesHeuristics() const { return IsPathBased() && !bUnweighted; }
 };
 
 struct FPCGExClusterCentralityContext final : FPCGExClustersProcessorContext
@@ -156,12 +167,40 @@ namespace PCGExClusterCentrality
 {
 	using NodePred = TArray<int32, TInlineAllocator<4>>;
 
+	constexpr int32 NumLanes = 64;
+
+	/** Scratch state for the bitset multi-source BFS. Each bit of a mask is one source lane. */
+	struct FMultiSourceBFS
+	{
+		TArray<uint64> Seen;
+		TArray<uint64> Visit;
+		TArray<uint64> VisitNext;
+		TArray<int32> Frontier;
+		TArray<int32> NextFrontier;
+		TArray<int32> Touched;
+
+		explicit FMultiSourceBFS(const int32 NumNodes)
+		{
+			Seen.Init(0, NumNodes);
+			Visit.Init(0, NumNodes);
+			VisitNext.Init(0, NumNodes);
+			Frontier.Reserve(NumNodes);
+			NextFrontier.Reserve(NumNodes);
+			Touched.Reserve(NumNodes);
+		}
+	};
+
 	class FProcessor final : public PCGExClusterMT::TProcessor<FPCGExClusterCentralityContext, UPCGExClusterCentralitySettings>
 	{
 		friend class FBatch;
 
 	protected:
 		bool bDownsample = false;
+		bool bMultiSource = false;
+		bool bAdaptive = false;
+
+		int32 AdaptiveCursor = 0;
+		int32 AdaptiveRoundSize = 0;
 
 		FRWLock CompletionLock;
 		bool bVtxComplete = true;
@@ -172,6 +211,16 @@ namespace PCGExClusterCentrality
 		TArray<double> CentralityScores;
 		TSharedPtr<PCGExMT::TScopedArray<double>> ScopedCentralityScores;
 
+		TArray<double> SampledSquares;
+		TSharedPtr<PCGExMT::TScopedArray<double>> ScopedCentralitySquares;
+
+		/** Pool of reusable multi-source BFS states, so batches don't each allocate their N-sized masks */
+		TArray<TSharedPtr<FMultiSourceBFS>> BFSStatePool;
+		FCriticalSection BFSStatePoolLock;
+
+		TSharedPtr<FMultiSourceBFS> AcquireBFSState();
+		void ReleaseBFSState(const TSharedPtr<FMultiSourceBFS>& State);
+
 	public:
 		FProcessor(const TSharedRef<PCGExData::FFacade>& InVtxDataFacade, const TSharedRef<PCGExData::FFacade>& InEdgeDataFacade)
 			: TProcessor(InVtxDataFacade, InEdgeDataFacade)
@@ -189,6 +238,11 @@ namespace PCGExClusterCentrality
 		virtual void OnNodesProcessingComplete() override;
 
 		void TryStartCompute();
+		void StartAdaptiveRound();
+		bool IsAdaptiveConverged() const;
+
+		FORCEINLINE int32 GetNumSources() const { return bDownsample ? RandomSamples.Num() : NumNodes; }
+		FORCEINLINE int32 GetSource(const int32 Index) const { return bDownsample ? RandomSamples[Index] : Index; }
 
 		virtual void PrepareLoopScopesForRanges(const TArray<PCGExMT::FScope>& Loops) override;
 		virtual void ProcessRange(const PCGExMT::FScope& Scope) override;
@@ -196,10 +250,13 @@ namespace PCGExClusterCentrality
 
 		void WriteResults();
 
-		void ProcessSingleNode_Betweenness(const int32 Index, TArray<double>& LocalScores, TArray<double>& Score, TArray<double>& Sigma, TArray<double>& Delta, TArray<NodePred>& Pred, TArray<int32>& Stack, const TSharedPtr<PCGEx::FScoredQueue>& Queue);
+		void ProcessSingleNode_Betweenness(const int32 Index, TArray<double>& LocalScores, TArray<double>* LocalSquares, TArray<double>& Score, TArray<double>& Sigma, TArray<double>& Delta, TArray<NodePred>& Pred, TArray<int32>& Stack, const TSharedPtr<PCGEx::FScoredQueue>& Queue);
 		void ProcessSingleNode_Closeness(const int32 Index, TArray<double>& LocalScores, TArray<double>& Score, TArray<int32>& Stack, const TSharedPtr<PCGEx::FScoredQueue>& Queue);
 		void ProcessSingleNode_HarmonicCloseness(const int32 Index, TArray<double>& LocalScores, TArray<double>& Score, TArray<int32>& Stack, const TSharedPtr<PCGEx::FScoredQueue>& Queue);
 
+		void ProcessSingleNode_BetweennessBFS(const int32 Index, TArray<double>& LocalScores, TArray<double>* LocalSquares, TArray<int32>& Depth, TArray<double>& Sigma, TArray<double>& Delta, TArray<int32>& Queue);
+		void ProcessBatch_MultiSourceBFS(const int32 BatchIndex, FMultiSourceBFS& State);
+
 		void ComputeEigenvector();
 		void ComputeKatz();
 	};
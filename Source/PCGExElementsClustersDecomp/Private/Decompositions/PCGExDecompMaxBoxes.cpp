@@ -3,6 +3,8 @@
 
 #include "Decompositions/PCGExDecompMaxBoxes.h"
 
+#include "Async/ParallelFor.h"
+
 #pragma region FPCGExDecompMaxBoxes
 
 bool FPCGExDecompMaxBoxes::Decompose(FPCGExDecompositionResult& OutResult)
@@ -38,15 +40,49 @@ bool FPCGExDecompMaxBoxes::Decompose(FPCGExDecompositionResult& OutResult)
 	int32 NextCellID = 0;
 	TArray<int32> CellVoxelCounts; // Track occupied voxel count per CellID
 
+	const int32 GX = Grid.GridDimensions.X;
+	const int32 GY = Grid.GridDimensions.Y;
+	const int32 GZ = Grid.GridDimensions.Z;
+
+	// Consecutive available voxels from each voxel upward, built top-down per column
+	TArray<int32> ColumnDepth;
+	ColumnDepth.SetNumUninitialized(Grid.TotalVoxels);
+	for (int32 Y = 0; Y < GY; Y++)
+	{
+		for (int32 X = 0; X < GX; X++)
+		{
+			int32 Depth = 0;
+			for (int32 Z = GZ - 1; Z >= 0; Z--)
+			{
+				const int32 Flat = Grid.FlatIndex(X, Y, Z);
+				Depth = Available[Flat] ? Depth + 1 : 0;
+				ColumnDepth[Flat] = Depth;
+			}
+		}
+	}
+
+	// Per-slab best boxes, kept across extractions.
+	// A carved box only changes the columns of its footprint: slabs below or above it keep their box,
+	// and so do the rows before its first row.
+	TArray<FSlabBox> SlabBoxes;
+	SlabBoxes.SetNum(GZ * GZ);
+
+	FIntVector DirtyMin = FIntVector::ZeroValue;
+	int32 DirtyMaxZ = GZ - 1;
+
 	// Iteratively extract the best box (compactness-scored when Balance > 0, pure volume otherwise)
 	while (RemainingCount > 0)
 	{
 		FIntVector BoxMin, BoxMax;
 		int32 BoxVolume = 0;
 
-		if (!FindLargestBox(Grid, Available, BoxMin, BoxMax, BoxVolume) || BoxVolume == 0) { break; }
+		if (!FindLargestBox(Grid, ColumnDepth, SlabBoxes, DirtyMin, DirtyMaxZ, BoxMin, BoxMax, BoxVolume) || BoxVolume == 0) { break; }
 
 		SubdivideAndClaim(Grid, BoxMin, BoxMax, MaxExtent, Available, VoxelCellIDs, NextCellID, RemainingCount, CellVoxelCounts);
+		UpdateColumnDepth(Grid, Available, BoxMin, BoxMax, ColumnDepth);
+
+		DirtyMin = BoxMin;
+		DirtyMaxZ = BoxMax.Z;
 	}
 
 	// Merge adjacent cells that together form a perfect box
@@ -103,116 +139,180 @@ bool FPCGExDecompMaxBoxes::Decompose(FPCGExDecompositionResult& OutResult)
 
 bool FPCGExDecompMaxBoxes::FindLargestBox(
 	const FPCGExDecompOccupancyGrid& Grid,
-	const TBitArray<>& Available,
+	const TArray<int32>& ColumnDepth,
+	TArray<FSlabBox>& SlabBoxes,
+	const FIntVector& DirtyMin,
+	const int32 DirtyMaxZ,
 	FIntVector& OutMin,
 	FIntVector& OutMax,
 	int32& OutVolume) const
 {
-	const int32 GX = Grid.GridDimensions.X;
-	const int32 GY = Grid.GridDimensions.Y;
 	const int32 GZ = Grid.GridDimensions.Z;
 
+	// Slabs starting above the dirty range don't contain any of the carved layers.
+	// Sweeps for different Z1 are independent and write to their own slab entries.
+	const int32 NumSweeps = FMath::Min(DirtyMaxZ + 1, GZ);
+	ParallelFor(NumSweeps, [&](const int32 Z1) { SweepSlabs(Grid, ColumnDepth, Z1, DirtyMin, SlabBoxes); }, NumSweeps < 2);
+
+	// Slabs are compared in the same Z1, Z2 order as a single full sweep, so ties resolve identically
 	OutVolume = 0;
 	double BestScore = -1.0;
+
+	for (int32 Z1 = 0; Z1 < GZ; Z1++)
+	{
+		for (int32 Z2 = Z1; Z2 < GZ; Z2++)
+		{
+			const FSlabBox& Slab = SlabBoxes[Z1 * GZ + Z2];
+			if (Slab.Score > BestScore)
+			{
+				BestScore = Slab.Score;
+				OutVolume = Slab.Volume;
+				OutMin = Slab.Min;
+				OutMax = Slab.Max;
+			}
+		}
+	}
+
+	return OutVolume > 0;
+}
+
+void FPCGExDecompMaxBoxes::SweepSlabs(
+	const FPCGExDecompOccupancyGrid& Grid,
+	const TArray<int32>& ColumnDepth,
+	const int32 Z1,
+	const FIntVector& DirtyMin,
+	TArray<FSlabBox>& SlabBoxes) const
+{
+	const int32 GX = Grid.GridDimensions.X;
+	const int32 GY = Grid.GridDimensions.Y;
+	const int32 GZ = Grid.GridDimensions.Z;
+
 	const bool bUseBalance = Balance > KINDA_SMALL_NUMBER;
 
-	// ColAvail[x + y * GX] = true iff ALL z-layers from Z1 to current Z2 at (x,y) are available
-	TArray<bool> ColAvail;
-	ColAvail.SetNum(GX * GY);
+	// Z1 layer of ColumnDepth, a column (x,y) is in the Z1..Z2 slab mask iff its depth covers Z2
+	const int32* Depths = ColumnDepth.GetData() + Grid.FlatIndex(0, 0, Z1);
 
-	// Y-direction histogram: Hist[x] = consecutive Y rows where ColAvail is true
+	int32 MaxDepth = 0;
+	for (int32 Idx2D = 0; Idx2D < GX * GY; Idx2D++) { MaxDepth = FMath::Max(MaxDepth, Depths[Idx2D]); }
+
+	// Y-direction histogram: Hist[x] = consecutive Y rows where the column is in the slab mask
 	TArray<int32> Hist;
 	Hist.SetNum(GX);
 
 	// Stack for the largest-rectangle-in-histogram algorithm
 	TArray<TPair<int32, int32>> Stack; // (start_index, height)
 
-	for (int32 Z1 = 0; Z1 < GZ; Z1++)
+	// Slabs entirely below the carved layers keep their cached boxes
+	for (int32 Z2 = FMath::Max(Z1, DirtyMin.Z); Z2 < GZ; Z2++)
 	{
-		// Reset ColAvail for new Z1
-		for (int32 i = 0; i < GX * GY; i++) { ColAvail[i] = true; }
+		const int32 ZDepth = Z2 - Z1 + 1;
+		const int32 SlabIdx = Z1 * GZ + Z2;
 
-		for (int32 Z2 = Z1; Z2 < GZ; Z2++)
+		// Deeper slabs can only be emptier, and stay empty for good
+		if (ZDepth > MaxDepth)
+		{
+			for (int32 Z = Z2; Z < GZ; Z++) { SlabBoxes[Z1 * GZ + Z] = FSlabBox(); }
+			return;
+		}
+
+		// Rows before the carved footprint are unchanged. If the cached best box ends there it still stands and
+		// rescanning from the footprint's first row is enough: later rows only replace it with a strictly better box,
+		// exactly as a full pass would. Otherwise the whole slab is swept again.
+		FSlabBox& Best = SlabBoxes[SlabIdx];
+
+		int32 StartY = 0;
+		if (Best.Score >= 0 && Best.Max.Y < DirtyMin.Y) { StartY = DirtyMin.Y; }
+		else { Best = FSlabBox(); }
+
+		// Rebuild the histogram the skipped rows lead into
+		for (int32 X = 0; X < GX; X++)
 		{
-			const int32 ZDepth = Z2 - Z1 + 1;
+			int32 H = 0;
+			while (H < StartY && Depths[X + (StartY - 1 - H) * GX] >= ZDepth) { H++; }
+			Hist[X] = H;
+		}
 
-			// AND in the Z2 layer: ColAvail stays true only if Z2 layer is also available
-			for (int32 Y = 0; Y < GY; Y++)
+		for (int32 Y = StartY; Y < GY; Y++)
+		{
+			// Update histogram: increment for available columns, reset for unavailable
+			for (int32 X = 0; X < GX; X++)
 			{
-				for (int32 X = 0; X < GX; X++)
-				{
-					const int32 Idx2D = X + Y * GX;
-					if (ColAvail[Idx2D])
-					{
-						ColAvail[Idx2D] = Available[Grid.FlatIndex(X, Y, Z2)];
-					}
-				}
+				Hist[X] = Depths[X + Y * GX] >= ZDepth ? (Hist[X] + 1) : 0;
 			}
 
-			// Find largest rectangle in the 2D ColAvail mask using histogram method
-			// Reset Y-histogram
-			for (int32 X = 0; X < GX; X++) { Hist[X] = 0; }
+			// Largest rectangle in histogram (stack-based, O(GX))
+			Stack.Reset();
 
-			for (int32 Y = 0; Y < GY; Y++)
+			for (int32 X = 0; X <= GX; X++)
 			{
-				// Update histogram: increment for available columns, reset for unavailable
-				for (int32 X = 0; X < GX; X++)
-				{
-					Hist[X] = ColAvail[X + Y * GX] ? (Hist[X] + 1) : 0;
-				}
-
-				// Largest rectangle in histogram (stack-based, O(GX))
-				Stack.Reset();
+				const int32 H = (X < GX) ? Hist[X] : 0;
+				int32 Start = X;
 
-				for (int32 X = 0; X <= GX; X++)
+				while (Stack.Num() > 0 && Stack.Last().Value >= H)
 				{
-					const int32 H = (X < GX) ? Hist[X] : 0;
-					int32 Start = X;
-
-					while (Stack.Num() > 0 && Stack.Last().Value >= H)
-					{
-						const int32 StackIdx = Stack.Last().Key;
-						const int32 StackHeight = Stack.Last().Value;
-						Stack.Pop(EAllowShrinking::No);
+					const int32 StackIdx = Stack.Last().Key;
+					const int32 StackHeight = Stack.Last().Value;
+					Stack.Pop(EAllowShrinking::No);
 
-						const int32 Width = X - StackIdx;
-						const int32 Volume = Width * StackHeight * ZDepth;
-
-						// Score: pure volume when Balance=0, cube-like preference when Balance>0
-						double Score;
-						if (bUseBalance)
-						{
-							// Compactness = second-largest / largest dimension (1.0 = perfect cube/square)
-							int32 d1 = Width, d2 = StackHeight, d3 = ZDepth;
-							if (d1 < d2) { Swap(d1, d2); }
-							if (d1 < d3) { Swap(d1, d3); }
-							if (d2 < d3) { Swap(d2, d3); }
-							const double Compactness = static_cast<double>(d2) / d1;
-							Score = Volume * FMath::Pow(Compactness, Balance * 2.0);
-						}
-						else
-						{
-							Score = static_cast<double>(Volume);
-						}
+					const int32 Width = X - StackIdx;
+					const int32 Volume = Width * StackHeight * ZDepth;
 
-						if (Score > BestScore)
-						{
-							BestScore = Score;
-							OutVolume = Volume;
-							OutMin = FIntVector(StackIdx, Y - StackHeight + 1, Z1);
-							OutMax = FIntVector(X - 1, Y, Z2);
-						}
+					// Score: pure volume when Balance=0, cube-like preference when Balance>0
+					double Score;
+					if (bUseBalance)
+					{
+						// Compactness = second-largest / largest dimension (1.0 = perfect cube/square)
+						int32 d1 = Width, d2 = StackHeight, d3 = ZDepth;
+						if (d1 < d2) { Swap(d1, d2); }
+						if (d1 < d3) { Swap(d1, d3); }
+						if (d2 < d3) { Swap(d2, d3); }
+						const double Compactness = static_cast<double>(d2) / d1;
+						Score = Volume * FMath::Pow(Compactness, Balance * 2.0);
+					}
+					else
+					{
+						Score = static_cast<double>(Volume);
+					}
 
-						Start = StackIdx;
+					if (Score > Best.Score)
+					{
+						Best.Score = Score;
+						Best.Volume = Volume;
+						Best.Min = FIntVector(StackIdx, Y - StackHeight + 1, Z1);
+						Best.Max = FIntVector(X - 1, Y, Z2);
 					}
 
-					Stack.Add(TPair<int32, int32>(Start, H));
+					Start = StackIdx;
 				}
+
+				Stack.Add(TPair<int32, int32>(Start, H));
 			}
 		}
 	}
+}
 
-	return OutVolume > 0;
+void FPCGExDecompMaxBoxes::UpdateColumnDepth(
+	const FPCGExDecompOccupancyGrid& Grid,
+	const TBitArray<>& Available,
+	const FIntVector& BoxMin,
+	const FIntVector& BoxMax,
+	TArray<int32>& ColumnDepth) const
+{
+	for (int32 Y = BoxMin.Y; Y <= BoxMax.Y; Y++)
+	{
+		for (int32 X = BoxMin.X; X <= BoxMax.X; X++)
+		{
+			for (int32 Z = BoxMin.Z; Z <= BoxMax.Z; Z++) { ColumnDepth[Grid.FlatIndex(X, Y, Z)] = 0; }
+
+			// The available run right below the box now stops at its bottom layer
+			for (int32 Z = BoxMin.Z - 1; Z >= 0; Z--)
+			{
+				const int32 Flat = Grid.FlatIndex(X, Y, Z);
+				if (!Available[Flat]) { break; }
+				ColumnDepth[Flat] = BoxMin.Z - Z;
+			}
+		}
+	}
 }
 
 void FPCGExDecompMaxBoxes::MergeAdjacentCells(
@@ -232,83 +332,109 @@ void FPCGExDecompMaxBoxes::MergeAdjacentCells(
 		int32 Count = 0;
 	};
 
-	bool bChanged = true;
-	while (bChanged)
+	// Flat per-CellID storage; CellIDs are bounded by NextCellID
+	TArray<FCellInfo> Cells;
+	Cells.SetNum(NextCellID);
+
+	// Per-cell AABB and voxel count are built once, then kept up to date merge after merge
+	for (int32 Flat = 0; Flat < Grid.TotalVoxels; Flat++)
 	{
-		bChanged = false;
+		const int32 CellID = VoxelCellIDs[Flat];
+		if (CellID < 0) { continue; }
+
+		const FIntVector Coord = Grid.UnflatIndex(Flat);
+		FCellInfo& Info = Cells[CellID];
+		Info.Min = FIntVector(
+			FMath::Min(Info.Min.X, Coord.X),
+			FMath::Min(Info.Min.Y, Coord.Y),
+			FMath::Min(Info.Min.Z, Coord.Z));
+		Info.Max = FIntVector(
+			FMath::Max(Info.Max.X, Coord.X),
+			FMath::Max(Info.Max.Y, Coord.Y),
+			FMath::Max(Info.Max.Z, Coord.Z));
+		Info.Count++;
+	}
 
-		// Build per-cell AABB and voxel count
-		TMap<int32, FCellInfo> Cells;
-		for (int32 Flat = 0; Flat < Grid.TotalVoxels; Flat++)
-		{
-			const int32 CellID = VoxelCellIDs[Flat];
-			if (CellID < 0) { continue; }
-
-			const FIntVector Coord = Grid.UnflatIndex(Flat);
-			FCellInfo& Info = Cells.FindOrAdd(CellID);
-			Info.Min = FIntVector(
-				FMath::Min(Info.Min.X, Coord.X),
-				FMath::Min(Info.Min.Y, Coord.Y),
-				FMath::Min(Info.Min.Z, Coord.Z));
-			Info.Max = FIntVector(
-				FMath::Max(Info.Max.X, Coord.X),
-				FMath::Max(Info.Max.Y, Coord.Y),
-				FMath::Max(Info.Max.Z, Coord.Z));
-			Info.Count++;
-		}
+	// Cells are boxes, so their first voxel is their min corner
+	auto FirstVoxel = [&](const int32 CellID) { return Grid.FlatIndex(Cells[CellID].Min.X, Cells[CellID].Min.Y, Cells[CellID].Min.Z); };
 
-		if (Cells.Num() <= 1) { break; }
+	// Face-adjacent cells, listed in the order the cell's voxels first touch them (flat order, then Dx/Dy/Dz order).
+	// Interior voxels only touch their own cell, so only the box's boundary layer is visited.
+	auto GatherNeighbors = [&](const int32 CellID, TArray<int32, TInlineAllocator<8>>& OutNeighbors)
+	{
+		OutNeighbors.Reset();
+		const FCellInfo& Info = Cells[CellID];
 
-		// Build face-adjacency between cells
-		TMap<int32, TSet<int32>> Adj;
-		for (int32 Flat = 0; Flat < Grid.TotalVoxels; Flat++)
+		for (int32 Z = Info.Min.Z; Z <= Info.Max.Z; Z++)
 		{
-			const int32 CellID = VoxelCellIDs[Flat];
-			if (CellID < 0) { continue; }
-
-			const FIntVector Coord = Grid.UnflatIndex(Flat);
-			for (int32 Dir = 0; Dir < 6; Dir++)
+			for (int32 Y = Info.Min.Y; Y <= Info.Max.Y; Y++)
 			{
-				const int32 NX = Coord.X + Dx[Dir];
-				const int32 NY = Coord.Y + Dy[Dir];
-				const int32 NZ = Coord.Z + Dz[Dir];
-				if (!Grid.IsInBounds(NX, NY, NZ)) { continue; }
-
-				const int32 NCellID = VoxelCellIDs[Grid.FlatIndex(NX, NY, NZ)];
-				if (NCellID >= 0 && NCellID != CellID)
+				const bool bBoundaryRow = Z == Info.Min.Z || Z == Info.Max.Z || Y == Info.Min.Y || Y == Info.Max.Y;
+				for (int32 X = Info.Min.X; X <= Info.Max.X; X = (bBoundaryRow || X == Info.Max.X) ? X + 1 : Info.Max.X)
 				{
-					Adj.FindOrAdd(CellID).Add(NCellID);
+					for (int32 Dir = 0; Dir < 6; Dir++)
+					{
+						const int32 NX = X + Dx[Dir];
+						const int32 NY = Y + Dy[Dir];
+						const int32 NZ = Z + Dz[Dir];
+						if (!Grid.IsInBounds(NX, NY, NZ)) { continue; }
+
+						const int32 NCellID = VoxelCellIDs[Grid.FlatIndex(NX, NY, NZ)];
+						if (NCellID >= 0 && NCellID != CellID) { OutNeighbors.AddUnique(NCellID); }
+					}
 				}
 			}
 		}
+	};
+
+	// A cell that failed to merge stays unmergeable until itself or one of its neighbors changes;
+	// only cells flagged here are tested again.
+	TBitArray<> MayMerge;
+	MayMerge.Init(true, NextCellID);
+
+	TArray<int32> SortedCellIDs;
+	TArray<int32, TInlineAllocator<8>> NeighborsA;
+	TArray<int32, TInlineAllocator<8>> NeighborsB;
+
+	bool bChanged = true;
+	while (bChanged)
+	{
+		bChanged = false;
+
+		// List cells in order of their first voxel, as a full scan of the grid would
+		SortedCellIDs.Reset();
+		for (int32 CellID = 0; CellID < NextCellID; CellID++) { if (Cells[CellID].Count) { SortedCellIDs.Add(CellID); } }
+		if (SortedCellIDs.Num() <= 1) { break; }
+
+		SortedCellIDs.Sort([&](const int32 A, const int32 B) { return FirstVoxel(A) < FirstVoxel(B); });
 
 		// Sort cells by count ascending (merge smallest cells first)
-		TArray<int32> SortedCellIDs;
-		Cells.GetKeys(SortedCellIDs);
 		SortedCellIDs.Sort([&Cells](int32 A, int32 B) { return Cells[A].Count < Cells[B].Count; });
 
 		for (const int32 CellA : SortedCellIDs)
 		{
-			const FCellInfo* InfoA = Cells.Find(CellA);
-			if (!InfoA) { continue; }
+			if (!MayMerge[CellA]) { continue; }
+
+			const FCellInfo& InfoA = Cells[CellA];
+			GatherNeighbors(CellA, NeighborsA);
 
-			const TSet<int32>* AdjSet = Adj.Find(CellA);
-			if (!AdjSet) { continue; }
+			int32 CellB = -1;
+			FIntVector MMin = FIntVector::ZeroValue;
+			FIntVector MMax = FIntVector::ZeroValue;
 
-			for (const int32 CellB : *AdjSet)
+			for (const int32 CellN : NeighborsA)
 			{
-				const FCellInfo* InfoB = Cells.Find(CellB);
-				if (!InfoB) { continue; }
+				const FCellInfo& InfoN = Cells[CellN];
 
 				// Compute merged AABB
-				const FIntVector MMin(
-					FMath::Min(InfoA->Min.X, InfoB->Min.X),
-					FMath::Min(InfoA->Min.Y, InfoB->Min.Y),
-					FMath::Min(InfoA->Min.Z, InfoB->Min.Z));
-				const FIntVector MMax(
-					FMath::Max(InfoA->Max.X, InfoB->Max.X),
-					FMath::Max(InfoA->Max.Y, InfoB->Max.Y),
-					FMath::Max(InfoA->Max.Z, InfoB->Max.Z));
+				MMin = FIntVector(
+					FMath::Min(InfoA.Min.X, InfoN.Min.X),
+					FMath::Min(InfoA.Min.Y, InfoN.Min.Y),
+					FMath::Min(InfoA.Min.Z, InfoN.Min.Z));
+				MMax = FIntVector(
+					FMath::Max(InfoA.Max.X, InfoN.Max.X),
+					FMath::Max(InfoA.Max.Y, InfoN.Max.Y),
+					FMath::Max(InfoA.Max.Z, InfoN.Max.Z));
 				const FIntVector MSize = MMax - MMin + FIntVector(1, 1, 1);
 
 				// Check MaxExtent
@@ -316,22 +442,43 @@ void FPCGExDecompMaxBoxes::MergeAdjacentCells(
 
 				// Perfect box check: merged AABB volume must equal combined voxel count
 				const int32 MergedVolume = MSize.X * MSize.Y * MSize.Z;
-				if (MergedVolume != InfoA->Count + InfoB->Count) { continue; }
+				if (MergedVolume != InfoA.Count + InfoN.Count) { continue; }
 
-				// Valid merge -- absorb B into A
-				for (int32 Flat = 0; Flat < Grid.TotalVoxels; Flat++)
+				CellB = CellN;
+				break;
+			}
+
+			if (CellB == -1)
+			{
+				MayMerge[CellA] = false;
+				continue;
+			}
+
+			// Valid merge -- absorb B into A, B is a box so only its own voxels need relabeling
+			GatherNeighbors(CellB, NeighborsB);
+
+			const FCellInfo& InfoB = Cells[CellB];
+			for (int32 Z = InfoB.Min.Z; Z <= InfoB.Max.Z; Z++)
+			{
+				for (int32 Y = InfoB.Min.Y; Y <= InfoB.Max.Y; Y++)
 				{
-					if (VoxelCellIDs[Flat] == CellB) { VoxelCellIDs[Flat] = CellA; }
+					for (int32 X = InfoB.Min.X; X <= InfoB.Max.X; X++) { VoxelCellIDs[Grid.FlatIndex(X, Y, Z)] = CellA; }
 				}
+			}
 
-				Cells.FindOrAdd(CellA) = FCellInfo{MMin, MMax, InfoA->Count + InfoB->Count};
-				Cells.Remove(CellB);
+			FCellInfo& Merged = Cells[CellA];
+			Merged.Min = MMin;
+			Merged.Max = MMax;
+			Merged.Count += InfoB.Count;
+			Cells[CellB] = FCellInfo();
 
-				bChanged = true;
-				break;
-			}
+			// A grew, and every cell touching A or B now touches a different box
+			MayMerge[CellA] = true;
+			for (const int32 CellN : NeighborsA) { MayMerge[CellN] = true; }
+			for (const int32 CellN : NeighborsB) { MayMerge[CellN] = true; }
 
-			if (bChanged) { break; }
+			bChanged = true;
+			break;
 		}
 	}
 
@@ -29,17 +29,49 @@ public:
 	virtual bool Decompose(FPCGExDecompositionResult& OutResult) override;
 
 protected:
+	/** Best box found within a single Z1..Z2 slab. */
+	struct FSlabBox
+	{
+		double Score = -1.0;
+		int32 Volume = 0;
+		FIntVector Min = FIntVector::ZeroValue;
+		FIntVector Max = FIntVector::ZeroValue;
+	};
+
 	/**
 	 * Find the largest axis-aligned box where ALL voxels are available.
 	 * Uses the 2D histogram largest-rectangle method extended to 3D via Z-range iteration.
+	 * ColumnDepth holds, per voxel, the number of consecutive available voxels from it upward along Z,
+	 * so a (Z1, Z2) slab mask is a single compare per column instead of an AND over its layers.
+	 * SlabBoxes caches the best box of every (Z1, Z2) slab across calls (GZ * GZ, indexed Z1 * GZ + Z2).
+	 * Only slabs overlapping DirtyMin.Z..DirtyMaxZ are swept again, from row DirtyMin.Y when their box ends before it.
 	 */
 	bool FindLargestBox(
 		const FPCGExDecompOccupancyGrid& Grid,
-		const TBitArray<>& Available,
+		const TArray<int32>& ColumnDepth,
+		TArray<FSlabBox>& SlabBoxes,
+		const FIntVector& DirtyMin,
+		const int32 DirtyMaxZ,
 		FIntVector& OutMin,
 		FIntVector& OutMax,
 		int32& OutVolume) const;
 
+	/** Sweep all slabs starting at Z1, refreshing the cached boxes of those reaching DirtyMin.Z or above. */
+	void SweepSlabs(
+		const FPCGExDecompOccupancyGrid& Grid,
+		const TArray<int32>& ColumnDepth,
+		const int32 Z1,
+		const FIntVector& DirtyMin,
+		TArray<FSlabBox>& SlabBoxes) const;
+
+	/** Refresh ColumnDepth below and within a freshly claimed box; only the columns of its footprint change. */
+	void UpdateColumnDepth(
+		const FPCGExDecompOccupancyGrid& Grid,
+		const TBitArray<>& Available,
+		const FIntVector& BoxMin,
+		const FIntVector& BoxMax,
+		TArray<int32>& ColumnDepth) const;
+
 	/** Post-process: iteratively merge adjacent cells that together form a perfect box. */
 	void MergeAdjacentCells(
 		const FPCGExDecompOccupancyGrid& Grid,
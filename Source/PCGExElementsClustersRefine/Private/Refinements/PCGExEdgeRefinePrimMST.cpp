@@ -3,9 +3,18 @@
 
 #include "Refinements/PCGExEdgeRefinePrimMST.h"
 
+#include "Async/ParallelFor.h"
+#include "Clusters/PCGExSpanningForest.h"
+
 #pragma region FPCGExEdgeRefinePrimMST
 
 void FPCGExEdgeRefinePrimMST::Process()
+{
+	if (Algorithm == EPCGExMSTAlgorithm::Boruvka) { ProcessBoruvka(); }
+	else { ProcessPrim(); }
+}
+
+void FPCGExEdgeRefinePrimMST::ProcessPrim()
 {
 	const int32 NumNodes = Cluster->Nodes->Num();
 
@@ -55,6 +64,29 @@ void FPCGExEdgeRefinePrimMST::Process()
 	}
 }
 
+void FPCGExEdgeRefinePrimMST::ProcessBoruvka()
+{
+	const int32 NumEdges = Cluster->Edges->Num();
+
+	const PCGExClusters::FNode& RoamingSeedNode = *Heuristics->GetRoamingSeed();
+	const PCGExClusters::FNode& RoamingGoalNode = *Heuristics->GetRoamingGoal();
+
+	TArray<double> Weights;
+	Weights.SetNumUninitialized(NumEdges);
+
+	ParallelFor(
+		NumEdges, [&](const int32 i)
+		{
+			const PCGExGraphs::FEdge& Edge = *Cluster->GetEdge(i);
+			Weights[i] = Heuristics->GetEdgeScore(*Cluster->GetEdgeStart(Edge), *Cluster->GetEdgeEnd(Edge), Edge, RoamingSeedNode, RoamingGoalNode, nullptr, nullptr);
+		}, NumEdges < 1024);
+
+	TArray<int8> InForest;
+	PCGExClusters::SpanningForest::Boruvka(Cluster.Get(), Weights, InForest);
+
+	for (int32 i = 0; i < NumEdges; i++) { if (InForest[i]) { Cluster->GetEdge(i)->bValid = !bInvert; } }
+}
+
 #pragma endregion
 
 #pragma region UPCGExEdgeRefinePrimMST
@@ -64,6 +96,7 @@ void UPCGExEdgeRefinePrimMST::CopySettingsFrom(const UPCGExInstancedFactory* Oth
 	Super::CopySettingsFrom(Other);
 	if (const UPCGExEdgeRefinePrimMST* TypedOther = Cast<UPCGExEdgeRefinePrimMST>(Other))
 	{
+		Algorithm = TypedOther->Algorithm;
 		bInvert = TypedOther->bInvert;
 	}
 }
@@ -9,6 +9,13 @@
 #include "Utils/PCGExScoredQueue.h"
 #include "PCGExEdgeRefinePrimMST.generated.h"
 
+UENUM()
+enum class EPCGExMSTAlgorithm : uint8
+{
+	Prim    = 0 UMETA(DisplayName = "Prim", ToolTip="Grow a single tree from the roaming seed, single-threaded."),
+	Boruvka = 1 UMETA(DisplayName = "Boruvka", ToolTip="Merge components along their cheapest edges, in parallel. Scores are evaluated once per edge, from start to end, without travel history; ties break on edge index. Spans every connected component."),
+};
+
 /**
  *
  */
@@ -17,7 +24,12 @@ class FPCGExEdgeRefinePrimMST : public FPCGExEdgeRefineOperation
 public:
 	virtual void Process() override;
 
+	EPCGExMSTAlgorithm Algorithm = EPCGExMSTAlgorithm::Prim;
 	bool bInvert = false;
+
+protected:
+	void ProcessPrim();
+	void ProcessBoruvka();
 };
 
 /**
@@ -34,9 +46,15 @@ public:
 
 	virtual void CopySettingsFrom(const UPCGExInstancedFactory* Other) override;
 
+	/** Spanning tree algorithm.
+	 * Prim grows from the roaming seed using directed, history-aware scores, ties following queue order; Boruvka scores each edge once, start to end, and breaks ties on edge index.
+	 * Results may differ with direction-dependent or travel-dependent heuristics, tied scores, or clusters with several components. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_NotOverridable))
+	EPCGExMSTAlgorithm Algorithm = EPCGExMSTAlgorithm::Prim;
+
 	/** Invert the refinement result (keep edges that would be removed and vice versa). */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable))
 	bool bInvert = false;
 
-	PCGEX_CREATE_REFINE_OPERATION(EdgeRefinePrimMST, { Operation->bInvert = bInvert; })
+	PCGEX_CREATE_REFINE_OPERATION(EdgeRefinePrimMST, { Operation->Algorithm = Algorithm; Operation->bInvert = bInvert; })
 };
@@ -22,6 +22,125 @@
 
 namespace PCGExFloodFill
 {
+	void FCandidateQueue::Init(const EPCGExFloodFillPrioritization InMode, const int32 InReserve)
+	{
+		Comparator = FCandidateHeapComparator(InMode);
+		Empty();
+		if (InMode == EPCGExFloodFillPrioritization::Heuristics) { Heap.Reserve(InReserve); }
+	}
+
+	void FCandidateQueue::Push(const FCandidate& InCandidate)
+	{
+		Num++;
+
+		if (Comparator.Mode == EPCGExFloodFillPrioritization::Heuristics)
+		{
+			Heap.HeapPush(InCandidate, Comparator);
+			return;
+		}
+
+		const int32 Depth = FMath::Max(0, InCandidate.Depth);
+		if (Depth >= Buckets.Num()) { Buckets.SetNum(Depth + 1); }
+
+		// Buckets only hold a single depth, so the comparator falls through to score ordering
+		Buckets[Depth].HeapPush(InCandidate, Comparator);
+		Cursor = FMath::Min(Cursor, Depth);
+	}
+
+	void FCandidateQueue::Pop(FCandidate& OutCandidate)
+	{
+		check(Num > 0)
+		Num--;
+
+		if (Comparator.Mode == EPCGExFloodFillPrioritization::Heuristics)
+		{
+			Heap.HeapPop(OutCandidate, Comparator, EAllowShrinking::No);
+			return;
+		}
+
+		while (Buckets[Cursor].IsEmpty()) { Cursor++; }
+		Buckets[Cursor].HeapPop(OutCandidate, Comparator, EAllowShrinking::No);
+	}
+
+	void FCandidateQueue::Empty()
+	{
+		Heap.Empty();
+		Buckets.Empty();
+		Cursor = 0;
+		Num = 0;
+	}
+
+	FConcurrentScheduler::FConcurrentScheduler(const int32 InNumDiffusions, const int32 InBatchSize)
+		: Alive(InNumDiffusions), BatchSize(FMath::Max(1, InBatchSize))
+	{
+		Pending[0].SetNumUninitialized(InNumDiffusions);
+		for (int32 i = 0; i < InNumDiffusions; i++) { Pending[0][i] = i; }
+	}
+
+	bool FConcurrentScheduler::Pull(TArray<int32>& OutBatch, int32& OutRound)
+	{
+		OutBatch.Reset();
+
+		while (true)
+		{
+			{
+				FScopeLock ScopeLock(&Lock);
+
+				if (Alive <= 0) { return false; }
+				if (TryPullUnsafe(OutBatch, OutRound)) { return true; }
+
+				// Everything left is being grown elsewhere; reset under the lock so a Push can't slip in unnoticed
+				WorkEvent->Reset();
+				NumWaiting++;
+			}
+
+			WorkEvent->Wait();
+
+			{
+				FScopeLock ScopeLock(&Lock);
+				NumWaiting--;
+			}
+		}
+	}
+
+	bool FConcurrentScheduler::TryPullUnsafe(TArray<int32>& OutBatch, int32& OutRound)
+	{
+		// Only look one round ahead so the spread between the slowest and fastest diffusion stays bounded
+		for (int32 Round = Cursor; Round <= Cursor + 1; Round++)
+		{
+			TArray<int32>& Bucket = Pending[Round % NumRounds];
+			if (Bucket.IsEmpty()) { continue; }
+
+			const int32 Count = FMath::Min(BatchSize, Bucket.Num());
+			const int32 Start = Bucket.Num() - Count;
+
+			OutBatch.Append(Bucket.GetData() + Start, Count);
+			Bucket.SetNum(Start, EAllowShrinking::No);
+
+			InFlight[Round % NumRounds] += Count;
+			OutRound = Round;
+			return true;
+		}
+
+		return false;
+	}
+
+	void FConcurrentScheduler::Push(const int32 Round, const TArray<int32>& Continuing, const int32 NumStopped)
+	{
+		FScopeLock ScopeLock(&Lock);
+
+		InFlight[Round % NumRounds] -= Continuing.Num() + NumStopped;
+		Alive -= NumStopped;
+
+		Pending[(Round + 1) % NumRounds].Append(Continuing);
+
+		// Advance past fully drained rounds
+		while (Alive > 0 && Pending[Cursor % NumRounds].IsEmpty() && InFlight[Cursor % NumRounds] == 0) { Cursor++; }
+
+		// Returned work or an advanced cursor may unblock sleeping workers, and they need to exit once all diffusions stopped
+		if (NumWaiting > 0) { WorkEvent->Trigger(); }
+	}
+
 	FDiffusion::FDiffusion(const TSharedPtr<FFillControlsHandler>& InFillControlsHandler, const TSharedPtr<PCGExClusters::FCluster>& InCluster, const PCGExClusters::FNode* InSeedNode)
 		: FillControlsHandler(InFillControlsHandler), SeedNode(InSeedNode), Cluster(InCluster)
 	{
@@ -32,8 +151,7 @@ namespace PCGExFloodFill
 		Visited.Init(false, NumNodes);
 
 		// Pre-reserve arrays to avoid reallocations during growth
-		Candidates.Reserve(NumNodes / 4); // Heuristic: ~25% of nodes as candidates at any time
-		Captured.Reserve(NumNodes / 2);   // Heuristic: ~50% of nodes may be captured
+		Captured.Reserve(NumNodes / 2); // Heuristic: ~50% of nodes may be captured
 	}
 
 	int32 FDiffusion::GetSettingsIndex(EPCGExFloodFillSettingSource Source) const
@@ -45,8 +163,8 @@ namespace PCGExFloodFill
 	{
 		SeedIndex = InSeedIndex;
 
-		// Initialize heap comparator with sorting mode from config
-		HeapComparator = FCandidateHeapComparator(Config.Sorting);
+		// Initialize candidate queue with sorting mode from config
+		Candidates.Init(Config.Sorting, Cluster->Nodes->Num() / 4); // Heuristic: ~25% of nodes as candidates at any time
 
 		Visited[SeedNode->Index] = true;
 		*(FillControlsHandler->InfluencesCount->GetData() + SeedNode->PointIndex) = 1;
@@ -97,8 +215,7 @@ namespace PCGExFloodFill
 
 			if (FillControlsHandler->IsValidCandidate(this, From, Candidate))
 			{
-				// O(log n) heap insertion instead of O(1) array add + O(n log n) sort later
-				Candidates.HeapPush(Candidate, HeapComparator);
+				Candidates.Push(Candidate);
 			}
 		}
 	}
@@ -116,9 +233,8 @@ namespace PCGExFloodFill
 				break;
 			}
 
-			// O(log n) heap pop instead of O(1) array pop (but we saved O(n log n) sort)
 			FCandidate Candidate;
-			Candidates.HeapPop(Candidate, HeapComparator, EAllowShrinking::No);
+			Candidates.Pop(Candidate);
 
 			if (!FillControlsHandler->TryCapture(this, Candidate)) { continue; }
 
@@ -143,7 +259,7 @@ namespace PCGExFloodFill
 	void FDiffusion::PostGrow()
 	{
 		// Probe from last captured candidate
-		// New candidates are inserted via HeapPush, maintaining heap order - no sort needed
+		// New candidates are pushed in priority order - no sort needed
 		Probe(Captured.Last());
 	}
 
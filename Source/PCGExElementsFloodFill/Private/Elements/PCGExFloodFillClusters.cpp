@@ -228,6 +228,20 @@ namespace PCGExClusterDiffusion
 	{
 		if (OngoingDiffusions.IsEmpty()) { return; }
 
+		if (Settings->Processing == EPCGExFloodFillProcessing::Concurrent)
+		{
+			// Single scheduled pass : each worker keeps pulling diffusions from the shared scheduler until all of them stopped
+			constexpr int32 BatchSize = 16;
+			Scheduler = MakeShared<PCGExFloodFill::FConcurrentScheduler>(OngoingDiffusions.Num(), BatchSize);
+
+			// Leave room for other clusters, and give each worker a few batches per round so they rarely have to wait
+			constexpr int32 BatchesPerWorker = 4;
+			const int32 MaxWorkers = FMath::Max(1, FTaskGraphInterface::Get().GetNumWorkerThreads() / 2);
+			const int32 NumWorkers = FMath::Clamp(FMath::DivideAndRoundUp(OngoingDiffusions.Num(), BatchSize * BatchesPerWorker), 1, MaxWorkers);
+			StartParallelLoopForRange(NumWorkers, 1);
+			return;
+		}
+
 		if (Settings->Processing == EPCGExFloodFillProcessing::Parallel)
 		{
 			// Grow all by a single step
@@ -244,8 +258,39 @@ namespace PCGExClusterDiffusion
 		Grow(); // Move to the next
 	}
 
+	void FProcessor::GrowConcurrent()
+	{
+		TArray<int32> Batch;
+		TArray<int32> Continuing;
+		int32 Round = 0;
+
+		while (Scheduler->Pull(Batch, Round))
+		{
+			Continuing.Reset();
+
+			for (const int32 DiffusionIndex : Batch)
+			{
+				const TSharedPtr<PCGExFloodFill::FDiffusion>& Diffusion = OngoingDiffusions[DiffusionIndex];
+				const int32 CurrentFillRate = FillRate->Read(Diffusion->GetSettingsIndex(Settings->Diffusion.FillRateSource));
+				for (int i = 0; i < CurrentFillRate && !Diffusion->bStopped; i++) { Diffusion->Grow(); }
+
+				// A zero fill rate never grows, treat it as stopped rather than cycling forever
+				if (CurrentFillRate <= 0) { Diffusion->bStopped = true; }
+				if (!Diffusion->bStopped) { Continuing.Add(DiffusionIndex); }
+			}
+
+			Scheduler->Push(Round, Continuing, Batch.Num() - Continuing.Num());
+		}
+	}
+
 	void FProcessor::ProcessRange(const PCGExMT::FScope& Scope)
 	{
+		if (Scheduler)
+		{
+			GrowConcurrent();
+			return;
+		}
+
 		PCGEX_SCOPE_LOOP(Index)
 		{
 			const TSharedPtr<PCGExFloodFill::FDiffusion> Diffusion = OngoingDiffusions[Index];
@@ -269,6 +314,7 @@ namespace PCGExClusterDiffusion
 		}
 
 		OngoingDiffusions.SetNum(WriteIndex);
+		Scheduler.Reset();
 
 		if (OngoingDiffusions.IsEmpty()) { return; }
 
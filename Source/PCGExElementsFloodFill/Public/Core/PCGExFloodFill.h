@@ -4,6 +4,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "HAL/Event.h"
 #include "Core/PCGExClustersProcessor.h"
 #include "PCGExFloodFill.generated.h"
 
@@ -186,6 +187,66 @@ namespace PCGExFloodFill
 		}
 	};
 
+	/**
+	 * Candidate priority queue.
+	 * Depth prioritization uses a bucket queue keyed by depth (candidates are always pushed deeper than the last pop),
+	 * each bucket being a small heap ordered by score. Heuristics prioritization falls back to a single binary heap.
+	 * Pop order is identical to FCandidateHeapComparator in both cases.
+	 */
+	class FCandidateQueue
+	{
+		FCandidateHeapComparator Comparator;
+		TArray<FCandidate> Heap;           // Heuristics
+		TArray<TArray<FCandidate>> Buckets; // Depth
+		int32 Cursor = 0;
+		int32 Num = 0;
+
+	public:
+		FCandidateQueue() = default;
+
+		void Init(const EPCGExFloodFillPrioritization InMode, const int32 InReserve);
+
+		FORCEINLINE bool IsEmpty() const { return Num == 0; }
+		void Push(const FCandidate& InCandidate);
+		void Pop(FCandidate& OutCandidate);
+		void Empty();
+	};
+
+	/**
+	 * Round-based work queue for the concurrent diffusion engine.
+	 * Workers pull small batches of diffusions from the lowest pending round and push them back one round later,
+	 * so all diffusions advance roughly in lockstep within a single scheduled pass, without a barrier per growth step.
+	 * Workers with nothing to pull sleep on an event until a batch is handed back or every diffusion has stopped.
+	 */
+	class PCGEXELEMENTSFLOODFILL_API FConcurrentScheduler : public TSharedFromThis<FConcurrentScheduler>
+	{
+		static constexpr int32 NumRounds = 3; // Pull window is [Cursor, Cursor + 1], pushes land at most at Cursor + 2
+
+		FCriticalSection Lock;
+		TArray<int32> Pending[NumRounds];
+		int32 InFlight[NumRounds] = {0, 0, 0};
+		int32 Cursor = 0;
+		int32 Alive = 0;
+		int32 NumWaiting = 0;
+		int32 BatchSize = 16;
+
+		FEventRef WorkEvent{EEventMode::ManualReset};
+
+		bool TryPullUnsafe(TArray<int32>& OutBatch, int32& OutRound);
+
+	public:
+		explicit FConcurrentScheduler(const int32 InNumDiffusions, const int32 InBatchSize = 16);
+
+		/**
+		 * Pull the next batch of diffusions to grow, waiting if all remaining work is in flight elsewhere.
+		 * Returns false once every diffusion has stopped.
+		 */
+		bool Pull(TArray<int32>& OutBatch, int32& OutRound);
+
+		/** Hand back a pulled batch. Continuing diffusions are queued for the next round. */
+		void Push(const int32 Round, const TArray<int32>& Continuing, const int32 NumStopped);
+	};
+
 	class FFillControlsHandler;
 
 	class FDiffusion : public TSharedFromThis<FDiffusion>
@@ -193,14 +254,13 @@ namespace PCGExFloodFill
 		friend class FFillControlsHandler;
 
 	protected:
-		TArray<bool> Visited; // Indexed by node index, faster than TSet for membership checks
+		TBitArray<> Visited; // Indexed by node index, faster than TSet for membership checks and 1 bit per node
 
 		int32 MaxDepth = 0;
 		double MaxDistance = 0;
 
 		TSharedPtr<FFillControlsHandler> FillControlsHandler;
-		FDiffusionConfig Config;                 // Local config snapshot, set by FFillControlsHandler::PrepareForDiffusions
-		FCandidateHeapComparator HeapComparator; // Cached comparator for heap operations
+		FDiffusionConfig Config; // Local config snapshot, set by FFillControlsHandler::PrepareForDiffusions
 
 	public:
 		int32 Index = -1;
@@ -212,7 +272,7 @@ namespace PCGExFloodFill
 		TSharedPtr<PCGEx::FHashLookupMap> TravelStack; // Required for FillControls & Heuristics
 		TSharedPtr<PCGExClusters::FCluster> Cluster;
 
-		TArray<FCandidate> Candidates;
+		FCandidateQueue Candidates;
 		TArray<FCandidate> Captured;
 
 		FDiffusion(const TSharedPtr<FFillControlsHandler>& InFillControlsHandler, const TSharedPtr<PCGExClusters::FCluster>& InCluster, const PCGExClusters::FNode* InSeedNode);
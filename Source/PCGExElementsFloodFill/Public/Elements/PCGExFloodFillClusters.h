@@ -31,8 +31,9 @@ enum class EPCGExFloodFillOrder : uint8
 UENUM()
 enum class EPCGExFloodFillProcessing : uint8
 {
-	Parallel = 0 UMETA(DisplayName = "Parallel", ToolTip="Diffuse each vtx once before moving to the next iteration."),
-	Sequence = 1 UMETA(DisplayName = "Sequential", ToolTip="Diffuse each vtx until it stops before moving to the next one, and so on."),
+	Parallel   = 0 UMETA(DisplayName = "Parallel", ToolTip="Diffuse each vtx once before moving to the next iteration."),
+	Sequence   = 1 UMETA(DisplayName = "Sequential", ToolTip="Diffuse each vtx until it stops before moving to the next one, and so on."),
+	Concurrent = 2 UMETA(DisplayName = "Concurrent", ToolTip="Grow all diffusions in a single scheduled pass. Diffusions advance round by round from a shared queue rather than waiting on a full pass per step. Much faster with many seeds; contested vtx go to whichever diffusion reaches them first."),
 };
 
 UENUM()
@@ -255,6 +256,7 @@ namespace PCGExClusterDiffusion
 		TSharedPtr<PCGExDetails::TSettingValue<int32>> FillRate;
 
 		TSharedPtr<PCGExMT::TScopedNumericValue<double>> MaxDistanceValue;
+		TSharedPtr<PCGExFloodFill::FConcurrentScheduler> Scheduler;
 
 		int32 ExpectedPathCount = 0;
 
@@ -273,6 +275,7 @@ namespace PCGExClusterDiffusion
 
 		void StartGrowth();
 		void Grow();
+		void GrowConcurrent();
 
 		virtual void ProcessRange(const PCGExMT::FScope& Scope) override;
 		virtual void OnRangeProcessingComplete() override;
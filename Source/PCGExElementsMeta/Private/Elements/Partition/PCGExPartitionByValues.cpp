@@ -8,6 +8,8 @@
 #include "Data/PCGExDataTags.h"
 #include "Data/PCGExPointIO.h"
 #include "Helpers/PCGExArrayHelpers.h"
+#include "Containers/PCGExScopedContainers.h"
+#include "Sorting/PCGExSortingHelpers.h"
 
 #define LOCTEXT_NAMESPACE "PCGExPartitionByValuesBase"
 #define PCGEX_NAMESPACE PartitionByValues
@@ -117,8 +119,7 @@ namespace PCGExPartitionByValuesBase
 
 		if (Settings->bWriteKeySum && !Settings->bSplitOutput) { PCGExArrayHelpers::InitArray(KeySums, NumPoints); }
 
-		// Initialize sorted indices array
-		PCGExArrayHelpers::ArrayOfIndices(SortedIndices, NumPoints);
+		if (Settings->bSplitOutput) { PointHashes.SetNumUninitialized(NumPoints); }
 
 		FName Consumable = NAME_None;
 
@@ -141,6 +142,12 @@ namespace PCGExPartitionByValuesBase
 		return true;
 	}
 
+	void FProcessor::PrepareLoopScopesForPoints(const TArray<PCGExMT::FScope>& Loops)
+	{
+		TProcessor::PrepareLoopScopesForPoints(Loops);
+		if (Settings->bSplitOutput) { ScopedRepresentatives = MakeShared<PCGExMT::TScopedArray<int32>>(Loops); }
+	}
+
 	void FProcessor::ProcessPoints(const PCGExMT::FScope& Scope)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(PCGEx::PartitionByValues::ProcessPoints);
@@ -156,6 +163,27 @@ namespace PCGExPartitionByValuesBase
 				Rule.FilteredValues[Index] = Rule.Filter(Index);
 			}
 		}
+
+		if (!Settings->bSplitOutput) { return; }
+
+		// Distinct composite keys seen in this scope, each represented by its first point
+		TArray<int32>& Representatives = ScopedRepresentatives->Get_Ref(Scope);
+		TMap<uint64, int32> ScopeGroups;
+
+		PCGEX_SCOPE_LOOP(Index)
+		{
+			const uint64 Hash = HashKeys(Index);
+			PointHashes[Index] = Hash;
+
+			if (const int32* Representative = ScopeGroups.Find(Hash))
+			{
+				if (KeysChanged(*Representative, Index)) { bHashCollision.store(true, std::memory_order_relaxed); }
+				continue;
+			}
+
+			ScopeGroups.Add(Hash, Index);
+			Representatives.Add(Index);
+		}
 	}
 
 	bool FProcessor::KeysChanged(const int32 IndexA, const int32 IndexB) const
@@ -167,6 +195,136 @@ namespace PCGExPartitionByValuesBase
 		return false;
 	}
 
+	bool FProcessor::KeysLess(const int32 IndexA, const int32 IndexB) const
+	{
+		for (const PCGExPartition::FRule& Rule : Rules)
+		{
+			const int64 KeyA = Rule.FilteredValues[IndexA];
+			const int64 KeyB = Rule.FilteredValues[IndexB];
+			if (KeyA != KeyB) { return KeyA < KeyB; }
+		}
+		return false;
+	}
+
+	uint64 FProcessor::HashKeys(const int32 Index) const
+	{
+		uint64 Hash = 0x9E3779B97F4A7C15ULL;
+		for (const PCGExPartition::FRule& Rule : Rules)
+		{
+			Hash = (Hash ^ static_cast<uint64>(Rule.FilteredValues[Index])) * 0xBF58476D1CE4E5B9ULL;
+			Hash ^= Hash >> 31;
+		}
+		return Hash;
+	}
+
+	bool FProcessor::GroupByHash()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGEx::PartitionByValues::GroupByHash);
+
+		if (bHashCollision.load() || !ScopedRepresentatives) { return false; }
+
+		const int32 NumPoints = PointHashes.Num();
+
+		// Merge per-scope groups; scopes are visited in order so each group keeps its lowest point as representative
+		TMap<uint64, int32> HashToGroup;
+		TArray<int32> Representatives;
+
+		bool bCollision = false;
+		ScopedRepresentatives->ForEach(
+			[&](const TArray<int32>& ScopeRepresentatives)
+			{
+				for (const int32 Index : ScopeRepresentatives)
+				{
+					const uint64 Hash = PointHashes[Index];
+					if (const int32* Existing = HashToGroup.Find(Hash))
+					{
+						if (KeysChanged(Representatives[*Existing], Index)) { bCollision = true; }
+						continue;
+					}
+
+					HashToGroup.Add(Hash, Representatives.Add(Index));
+				}
+			});
+
+		ScopedRepresentatives.Reset();
+		if (bCollision) { return false; }
+
+		// Partitions are ordered by key, same as the sort-based path
+		Representatives.Sort([&](const int32 A, const int32 B) { return KeysLess(A, B); });
+
+		const int32 NumGroups = Representatives.Num();
+		for (int32 i = 0; i < NumGroups; i++) { HashToGroup[PointHashes[Representatives[i]]] = i; }
+
+		TArray<PCGEx::FIndexKey> GroupKeys;
+		GroupKeys.SetNumUninitialized(NumPoints);
+
+		PCGEX_PARALLEL_FOR(
+			NumPoints,
+			GroupKeys[i] = PCGEx::FIndexKey(i, HashToGroup.FindChecked(PointHashes[i]));
+		)
+
+		// Stable counting scatter on group index : per-chunk histograms, prefix sum, parallel scatter
+		int32 NumBytes = 1;
+		while (NumBytes < 4 && (static_cast<uint64>(NumGroups - 1) >> (NumBytes * 8)) != 0) { NumBytes++; }
+
+		PCGExSortingHelpers::ParallelRadixSort(GroupKeys, [](const PCGEx::FIndexKey& Key) { return Key.Key; }, NumBytes);
+
+		SortedIndices.SetNumUninitialized(NumPoints);
+		PCGEX_PARALLEL_FOR(
+			NumPoints,
+			SortedIndices[i] = GroupKeys[i].Index;
+		)
+
+		PartitionRanges.Reset(NumGroups);
+
+		int32 CurrentStart = 0;
+		for (int32 i = 1; i < NumPoints; i++)
+		{
+			if (GroupKeys[i].Key == GroupKeys[i - 1].Key) { continue; }
+			PartitionRanges.Emplace(CurrentStart, i - CurrentStart);
+			CurrentStart = i;
+		}
+		PartitionRanges.Emplace(CurrentStart, NumPoints - CurrentStart);
+
+		return true;
+	}
+
+	void FProcessor::GroupBySort()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGEx::PartitionByValues::GroupBySort);
+
+		const int32 NumPoints = PointHashes.Num();
+		PCGExArrayHelpers::ArrayOfIndices(SortedIndices, NumPoints);
+
+		// Sort indices by lexicographic comparison of keys across all rules
+		SortedIndices.Sort(
+			[this](const int32 A, const int32 B)
+			{
+				for (const PCGExPartition::FRule& Rule : Rules)
+				{
+					const int64 KeyA = Rule.FilteredValues[A];
+					const int64 KeyB = Rule.FilteredValues[B];
+					if (KeyA != KeyB) { return KeyA < KeyB; }
+				}
+				return A < B; // Stable tiebreaker by original index
+			});
+
+		// Scan for partition boundaries
+		PartitionRanges.Empty();
+
+		int32 CurrentStart = 0;
+		for (int32 i = 1; i < NumPoints; i++)
+		{
+			if (KeysChanged(SortedIndices[i - 1], SortedIndices[i]))
+			{
+				PartitionRanges.Emplace(CurrentStart, i - CurrentStart);
+				CurrentStart = i;
+			}
+		}
+		// Add last partition
+		PartitionRanges.Emplace(CurrentStart, NumPoints - CurrentStart);
+	}
+
 	void FProcessor::BuildKeyToPartitionIndexMaps()
 	{
 		// Build per-rule key-to-partition-index maps for rules that need them
@@ -176,11 +334,12 @@ namespace PCGExPartitionByValuesBase
 			if (!Rule.RuleConfig->bUsePartitionIndexAsKey && !Rule.RuleConfig->bTagUsePartitionIndexAsKey) { continue; }
 
 			// Build key-to-index map for this rule based on sorted order
+			// A key first shows up at the start of a partition, so only representatives need to be visited
 			TMap<int64, int32> KeyToIndex;
 			int32 NextIndex = 0;
-			for (const int32 SortedIdx : SortedIndices)
+			for (const PCGExPartition::FPartitionRange& Range : PartitionRanges)
 			{
-				const int64 Key = Rule.FilteredValues[SortedIdx];
+				const int64 Key = Rule.FilteredValues[SortedIndices[Range.Start]];
 				if (!KeyToIndex.Contains(Key))
 				{
 					KeyToIndex.Add(Key, NextIndex++);
@@ -252,37 +411,8 @@ namespace PCGExPartitionByValuesBase
 
 		if (Settings->bSplitOutput)
 		{
-			const int32 NumPoints = SortedIndices.Num();
-
-			// Sort indices by lexicographic comparison of keys across all rules
-			SortedIndices.Sort(
-				[this](const int32 A, const int32 B)
-				{
-					for (const PCGExPartition::FRule& Rule : Rules)
-					{
-						const int64 KeyA = Rule.FilteredValues[A];
-						const int64 KeyB = Rule.FilteredValues[B];
-						if (KeyA != KeyB) { return KeyA < KeyB; }
-					}
-					return A < B; // Stable tiebreaker by original index
-				});
-
-			// Scan for partition boundaries
 			PartitionRanges.Empty();
-			if (NumPoints > 0)
-			{
-				int32 CurrentStart = 0;
-				for (int32 i = 1; i < NumPoints; i++)
-				{
-					if (KeysChanged(SortedIndices[i - 1], SortedIndices[i]))
-					{
-						PartitionRanges.Emplace(CurrentStart, i - CurrentStart);
-						CurrentStart = i;
-					}
-				}
-				// Add last partition
-				PartitionRanges.Emplace(CurrentStart, NumPoints - CurrentStart);
-			}
+			if (!PointHashes.IsEmpty() && !GroupByHash()) { GroupBySort(); }
 
 			// Build key-to-partition-index maps for rules that need them
 			BuildKeyToPartitionIndexMaps();
@@ -10,6 +10,12 @@
 
 #include "PCGExPartitionByValues.generated.h"
 
+namespace PCGExMT
+{
+	template <typename T>
+	class TScopedArray;
+}
+
 namespace PCGExPartition
 {
 	/** Simple struct representing a contiguous range of points belonging to a partition */
@@ -126,6 +132,11 @@ namespace PCGExPartitionByValuesBase
 		TArray<int32> SortedIndices;
 		TArray<PCGExPartition::FPartitionRange> PartitionRanges;
 
+		// Split mode grouping : composite key hash per point, and the first point of each distinct hash per scope
+		TArray<uint64> PointHashes;
+		TSharedPtr<PCGExMT::TScopedArray<int32>> ScopedRepresentatives;
+		std::atomic<bool> bHashCollision{false};
+
 	public:
 		explicit FProcessor(const TSharedRef<PCGExData::FFacade>& InPointDataFacade)
 			: TProcessor(InPointDataFacade)
@@ -133,12 +144,22 @@ namespace PCGExPartitionByValuesBase
 		}
 
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager>& InTaskManager) override;
+		virtual void PrepareLoopScopesForPoints(const TArray<PCGExMT::FScope>& Loops) override;
 		virtual void ProcessPoints(const PCGExMT::FScope& Scope) override;
 		virtual void ProcessRange(const PCGExMT::FScope& Scope) override;
 		virtual void CompleteWork() override;
 
 	protected:
 		bool KeysChanged(int32 IndexA, int32 IndexB) const;
+		bool KeysLess(int32 IndexA, int32 IndexB) const;
+		uint64 HashKeys(int32 Index) const;
+
+		/** Group points by composite key and scatter them into partitions, keeping input order within each. Returns false on hash collision. */
+		bool GroupByHash();
+
+		/** Fallback used on hash collision : full lexicographic sort of the point indices. */
+		void GroupBySort();
+
 		void BuildKeyToPartitionIndexMaps();
 	};
 }
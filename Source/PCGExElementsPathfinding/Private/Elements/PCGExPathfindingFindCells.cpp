@@ -307,24 +307,12 @@ namespace PCGExFindContours
 
 		TConstPCGValueRange<FTransform> SeedTransforms = Context->SeedsDataFacade->GetIn()->GetConstTransformValueRange();
 
+		TBitArray<> ConsumedSeeds;
+		FindConsumedSeeds(ConsumedSeeds);
+
 		for (int32 SeedIdx = 0; SeedIdx < NumSeeds; ++SeedIdx)
 		{
-			// Check if seed is inside any internal cell (consumed)
-			bool bConsumed = false;
-			const FVector2D& SeedPoint = Seeds->GetProjected(SeedIdx);
-
-			for (const TSharedPtr<PCGExClusters::FCell>& Cell : AllCellsIncludingFailed)
-			{
-				if (Cell && !Cell->Polygon.IsEmpty() &&
-					Cell->Bounds2D.IsInside(SeedPoint) &&
-					PCGExMath::Geo::IsPointInPolygon(SeedPoint, Cell->Polygon))
-				{
-					bConsumed = true;
-					break;
-				}
-			}
-
-			if (bConsumed) { continue; }
+			if (ConsumedSeeds[SeedIdx]) { continue; }
 
 			// Seed is exterior - find closest edge distance
 			const FVector& SeedPos = SeedTransforms[SeedIdx].GetLocation();
@@ -374,6 +362,46 @@ namespace PCGExFindContours
 		}
 	}
 
+	void FProcessor::FindConsumedSeeds(TBitArray<>& OutConsumed) const
+	{
+		const int32 NumSeeds = Seeds->Num();
+		OutConsumed.Init(false, NumSeeds);
+
+		// Resolve seeds through the enumerator's face index; it lives in the cluster cache and is shared with downstream nodes
+		const PCGExClusters::FPlanarFaceEnumerator* Enumerator = CellsConstraints->Enumerator.Get();
+		if (Enumerator && !Enumerator->IsLocalTangent())
+		{
+			TBitArray<> FaceMask;
+			FaceMask.Init(false, Enumerator->GetNumFaces());
+			for (const TSharedPtr<PCGExClusters::FCell>& Cell : AllCellsIncludingFailed)
+			{
+				if (Cell && !Cell->Polygon.IsEmpty() && FaceMask.IsValidIndex(Cell->FaceIndex)) { FaceMask[Cell->FaceIndex] = true; }
+			}
+
+			TArray<int32> SeedFaces;
+			Enumerator->FindFacesContaining(Seeds->GetProjectedPoints(), SeedFaces, &FaceMask);
+			for (int32 SeedIdx = 0; SeedIdx < NumSeeds; ++SeedIdx) { OutConsumed[SeedIdx] = SeedFaces[SeedIdx] != -1; }
+			return;
+		}
+
+		// LocalTangent cells carry per-face projected polygons, test them directly
+		for (int32 SeedIdx = 0; SeedIdx < NumSeeds; ++SeedIdx)
+		{
+			const FVector2D& SeedPoint = Seeds->GetProjected(SeedIdx);
+
+			for (const TSharedPtr<PCGExClusters::FCell>& Cell : AllCellsIncludingFailed)
+			{
+				if (Cell && !Cell->Polygon.IsEmpty() &&
+					Cell->Bounds2D.IsInside(SeedPoint) &&
+					PCGExMath::Geo::IsPointInPolygon(SeedPoint, Cell->Polygon))
+				{
+					OutConsumed[SeedIdx] = true;
+					break;
+				}
+			}
+		}
+	}
+
 	void FProcessor::OnRangeProcessingComplete()
 	{
 		ScopedValidCells->Collapse(ValidCells);
@@ -463,22 +491,11 @@ namespace PCGExFindContours
 
 			// Also mark seeds inside failed cells as consumed
 			const int32 NumSeeds = Seeds->Num();
+			TBitArray<> InsideCells;
+			FindConsumedSeeds(InsideCells);
 			for (int32 SeedIdx = 0; SeedIdx < NumSeeds; ++SeedIdx)
 			{
-				if (ConsumedSeeds.Contains(SeedIdx)) { continue; }
-
-				const FVector2D& SeedPoint = Seeds->GetProjected(SeedIdx);
-
-				for (const TSharedPtr<PCGExClusters::FCell>& Cell : AllCellsIncludingFailed)
-				{
-					if (Cell && !Cell->Polygon.IsEmpty() &&
-						Cell->Bounds2D.IsInside(SeedPoint) &&
-						PCGExMath::Geo::IsPointInPolygon(SeedPoint, Cell->Polygon))
-					{
-						ConsumedSeeds.Add(SeedIdx);
-						break;
-					}
-				}
+				if (InsideCells[SeedIdx]) { ConsumedSeeds.Add(SeedIdx); }
 			}
 
 			// Find best exterior seed within picking distance
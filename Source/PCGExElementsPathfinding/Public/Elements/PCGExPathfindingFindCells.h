@@ -205,6 +205,9 @@ namespace PCGExFindContours
 
 		void HandleWrapperOnlyCase(const int32 NumSeeds);
 
+		/** Flag seeds lying inside any internal cell, valid or failed. Those are consumed and can't claim the wrapper. */
+		void FindConsumedSeeds(TBitArray<>& OutConsumed) const;
+
 		/** Expand from a seed's initial cell to adjacent cells up to growth depth */
 		void ExpandSeedToAdjacentCells(int32 SeedIndex, int32 InitialFaceIndex, int32 MaxGrowth);
 
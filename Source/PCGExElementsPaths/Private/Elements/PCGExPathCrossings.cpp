@@ -11,6 +11,8 @@
 #include "Blenders/PCGExUnionBlender.h"
 #include "Data/PCGExData.h"
 #include "Math/PCGExMathDistances.h"
+#include "Math/PCGExBVH.h"
+#include "Async/ParallelFor.h"
 #include "Paths/PCGExPathsCommon.h"
 #include "Paths/PCGExPathsHelpers.h"
 
@@ -41,7 +43,7 @@ TArray<FPCGPinProperties> UPCGExPathCrossingsSettings::InputPinProperties() cons
 }
 
 PCGEX_INITIALIZE_ELEMENT(PathCrossings)
-PCGEX_ELEMENT_BATCH_POINT_IMPL(PathCrossings)
+PCGEX_ELEMENT_BATCH_POINT_IMPL_ADV(PathCrossings)
 
 bool FPCGExPathCrossingsElement::Boot(FPCGExContext* InContext) const
 {
@@ -121,6 +123,94 @@ namespace PCGExPathCrossings
 {
 	const PCGExPaths::FPathEdgeOctree* FProcessor::GetEdgeOctree() const { return Path->GetEdgeOctree(); }
 
+	FBatch::FBatch(FPCGExContext* InContext, const TArray<TWeakPtr<PCGExData::FPointIO>>& InPointsCollection)
+		: TBatch(InContext, InPointsCollection)
+	{
+	}
+
+	void FBatch::OnInitialPostProcess()
+	{
+		PCGEX_TYPED_CONTEXT_AND_SETTINGS(PathCrossings);
+
+		TBatch<FProcessor>::OnInitialPostProcess();
+
+		if (Settings->bSelfIntersectionOnly) { return; }
+
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExPathCrossings::BuildSharedEdgeBVH);
+
+		const int32 NumProcessors = Processors.Num();
+
+		CutterPaths.Init(nullptr, NumProcessors);
+
+		// Count cutter edges per processor, then prefix-sum into flat offsets
+		TArray<int32> Offsets;
+		Offsets.Init(0, NumProcessors + 1);
+
+		ParallelFor(
+			NumProcessors, [&](const int32 i)
+			{
+				const TSharedPtr<FProcessor> P = GetProcessor<FProcessor>(i);
+				if (!P->bIsProcessorValid || !P->bCanCut || !P->Path) { return; }
+
+				CutterPaths[i] = P->Path;
+
+				int32 Count = 0;
+				for (int32 e = 0; e < P->Path->NumEdges; e++) { if (P->CanCut[e] && P->Path->IsEdgeValid(e)) { Count++; } }
+				Offsets[i + 1] = Count;
+			}, NumProcessors < 64);
+
+		for (int32 i = 0; i < NumProcessors; i++) { Offsets[i + 1] += Offsets[i]; }
+
+		const int32 NumCutterEdges = Offsets[NumProcessors];
+
+		TArray<PCGExBVH::FItem> EdgeItems;
+		TArray<PCGExBVH::FItem> PathItems;
+
+		EdgeItems.SetNum(NumCutterEdges);
+		PathItems.SetNum(NumProcessors);
+		CutterEdges.SetNumUninitialized(NumCutterEdges);
+
+		ParallelFor(
+			NumProcessors, [&](const int32 i)
+			{
+				const TSharedPtr<FProcessor> P = GetProcessor<FProcessor>(i);
+				if (!CutterPaths[i])
+				{
+					P->CanCut.Empty();
+					return;
+				}
+
+				int32 WriteIndex = Offsets[i];
+				FBox PathBounds = FBox(ForceInit);
+
+				for (int32 e = 0; e < P->Path->NumEdges; e++)
+				{
+					if (!P->CanCut[e] || !P->Path->IsEdgeValid(e)) { continue; }
+
+					const FBox EdgeBox = P->Path->Edges[e].Bounds.GetBox();
+					PathBounds += EdgeBox;
+
+					EdgeItems[WriteIndex] = PCGExBVH::FItem(EdgeBox, WriteIndex);
+					CutterEdges[WriteIndex] = PCGEx::H64(i, e);
+					WriteIndex++;
+				}
+
+				PathItems[i] = PCGExBVH::FItem(PathBounds, i);
+				P->CanCut.Empty();
+			}, NumProcessors < 64);
+
+		// Drop non-cutters from the path broad phase
+		PathItems.RemoveAllSwap([](const PCGExBVH::FItem& Item) { return !Item.Bounds.IsValid; }, EAllowShrinking::No);
+
+		if (NumCutterEdges == 0) { return; }
+
+		EdgeBVH = MakeShared<PCGExBVH::FBVH>();
+		EdgeBVH->Build(MoveTemp(EdgeItems));
+
+		PathBVH = MakeShared<PCGExBVH::FBVH>();
+		PathBVH->Build(MoveTemp(PathItems), 1);
+	}
+
 	bool FProcessor::Process(const TSharedPtr<PCGExMT::FTaskManager>& InTaskManager)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExPathCrossings::Process);
@@ -186,9 +276,13 @@ namespace PCGExPathCrossings
 		CanCutFilterManager.Reset();
 		CanBeCutFilterManager.Reset();
 
-		if (bCanCut) { Path->BuildPartialEdgeOctree(CanCut); }
+		if (bSelfIntersectionOnly)
+		{
+			if (bCanCut) { Path->BuildPartialEdgeOctree(CanCut); }
+			CanCut.Empty();
+		}
 
-		CanCut.Empty();
+		// Otherwise CanCut is consumed by the batch when building the shared edge BVH
 
 		return true;
 	}
@@ -198,39 +292,72 @@ namespace PCGExPathCrossings
 		if (!bCanBeCut) { return; }
 		if (bSelfIntersectionOnly && !bCanCut) { return; }
 
+		if (!bSelfIntersectionOnly)
+		{
+			// Broad phase : skip edge queries entirely if no cutter path overlaps this one
+			const TSharedPtr<FBatch> TypedParent = StaticCastSharedPtr<FBatch>(ParentBatch.Pin());
+			if (!TypedParent) { return; }
+
+			bool bMayCross = false;
+			if (TypedParent->PathBVH)
+			{
+				TypedParent->PathBVH->FindElementsWithBoundsTest(
+					Path->Bounds.ExpandBy(Details.Tolerance), [&](const int32 OtherIndex)
+					{
+						if (OtherIndex != BatchIndex || Details.bEnableSelfIntersection) { bMayCross = true; }
+					});
+			}
+
+			if (!bMayCross)
+			{
+				OnRangeProcessingComplete();
+				return;
+			}
+		}
+
 		StartParallelLoopForRange(Path->NumEdges);
 	}
 
 	void FProcessor::ProcessRange(const PCGExMT::FScope& Scope)
 	{
-		const TSharedPtr<PCGExPointsMT::IBatch> Parent = ParentBatch.Pin();
-		if (!Parent) { return; }
-
-		const TSharedPtr<PCGExPointsMT::TBatch<FProcessor>> TypedParent = StaticCastSharedPtr<PCGExPointsMT::TBatch<FProcessor>>(Parent);
-
-		TArray<TSharedPtr<PCGExPaths::FPath>> Cutters;
-
 		if (bSelfIntersectionOnly)
 		{
-			if (bCanCut && Path->GetEdgeOctree()) { Cutters.Add(Path); }
-		}
-		else
-		{
-			Cutters.Reserve(Parent->ProcessorFacades.Num());
-
+			const PCGExPaths::FPathEdgeOctree* EdgeOctree = Path->GetEdgeOctree();
+			if (!bCanCut || !EdgeOctree) { return; }
 
-			for (int Pi = 0; Pi < TypedParent->GetNumProcessors(); Pi++)
+			PCGEX_SCOPE_LOOP(Index)
 			{
-				const TSharedPtr<FProcessor> P = TypedParent->GetProcessor<FProcessor>(Pi);
+				EdgeCrossings[Index] = nullptr;
+
+				if (!CanBeCut[Index]) { continue; }
 
-				if (!Details.bEnableSelfIntersection && P.Get() == this) { continue; }
-				if (!P->bCanCut || !P->Path->GetEdgeOctree()) { continue; }
+				const PCGExPaths::FPathEdge& Edge = Path->Edges[Index];
+				if (!Path->IsEdgeValid(Edge)) { continue; }
 
-				Cutters.Add(P->Path);
+				const TSharedPtr<PCGExPaths::FPathEdgeCrossings> NewCrossing = MakeShared<PCGExPaths::FPathEdgeCrossings>(Index);
+
+				EdgeOctree->FindElementsWithBoundsTest(Edge.Bounds.GetBox(), [&](const PCGExPaths::FPathEdge* OtherEdge)
+				{
+					NewCrossing->FindSplit(Path, Edge, PathLength, Path, *OtherEdge, Details);
+				});
+
+				if (!NewCrossing->IsEmpty())
+				{
+					FPlatformAtomics::InterlockedIncrement(&FoundCrossingsNum);
+					NewCrossing->SortByAlpha();
+					EdgeCrossings[Index] = NewCrossing;
+				}
 			}
+
+			return;
 		}
 
-		if (Cutters.IsEmpty()) { return; }
+		const TSharedPtr<FBatch> TypedParent = StaticCastSharedPtr<FBatch>(ParentBatch.Pin());
+		if (!TypedParent || !TypedParent->EdgeBVH || TypedParent->EdgeBVH->IsEmpty()) { return; }
+
+		const PCGExBVH::FBVH& EdgeBVH = *TypedParent->EdgeBVH.Get();
+		const TArray<uint64>& CutterEdges = TypedParent->CutterEdges;
+		const TArray<TSharedPtr<PCGExPaths::FPath>>& CutterPaths = TypedParent->CutterPaths;
 
 		PCGEX_SCOPE_LOOP(Index)
 		{
@@ -243,13 +370,17 @@ namespace PCGExPathCrossings
 
 			const TSharedPtr<PCGExPaths::FPathEdgeCrossings> NewCrossing = MakeShared<PCGExPaths::FPathEdgeCrossings>(Index);
 
-			for (const TSharedPtr<PCGExPaths::FPath>& OtherPath : Cutters)
+			EdgeBVH.FindElementsWithBoundsTest(Edge.Bounds.GetBox(), [&](const int32 CutterIndex)
 			{
-				OtherPath->GetEdgeOctree()->FindElementsWithBoundsTest(Edge.Bounds.GetBox(), [&](const PCGExPaths::FPathEdge* OtherEdge)
-				{
-					NewCrossing->FindSplit(Path, Edge, PathLength, OtherPath, *OtherEdge, Details);
-				});
-			}
+				uint32 OtherBatchIndex;
+				uint32 OtherEdgeIndex;
+				PCGEx::H64(CutterEdges[CutterIndex], OtherBatchIndex, OtherEdgeIndex);
+
+				if (!Details.bEnableSelfIntersection && static_cast<int32>(OtherBatchIndex) == BatchIndex) { return; }
+
+				const TSharedPtr<PCGExPaths::FPath>& OtherPath = CutterPaths[OtherBatchIndex];
+				NewCrossing->FindSplit(Path, Edge, PathLength, OtherPath, OtherPath->Edges[OtherEdgeIndex], Details);
+			});
 
 			if (!NewCrossing->IsEmpty())
 			{
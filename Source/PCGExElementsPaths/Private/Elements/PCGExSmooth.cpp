@@ -87,6 +87,7 @@ bool FPCGExSmoothElement::AdvanceWork(FPCGExContext* InContext, const UPCGExSett
 				return true;
 			}, [&](const TSharedPtr<PCGExPointsMT::IBatch>& NewBatch)
 			{
+				NewBatch->bPipelinedPhases = true;
 			}))
 		{
 			return Context->CancelExecution(TEXT("Could not find any paths to smooth."));
@@ -97,6 +97,7 @@ bool FPCGExWriteTangentsElement::AdvanceWork(FPCGExContext* InContext, const UPC
 				return true;
 			}, [&](const TSharedPtr<PCGExPointsMT::IBatch>& NewBatch)
 			{
+				NewBatch->bPipelinedPhases = true;
 			}))
 		{
 			return Context->CancelExecution(TEXT("Could not find any paths to write tangents to."));
@@ -20,6 +20,11 @@ namespace PCGExBlending
 	class IUnionBlender;
 }
 
+namespace PCGExBVH
+{
+	class FBVH;
+}
+
 namespace PCGExPaths
 {
 	struct FPathEdgeCrossings;
@@ -177,8 +182,12 @@ protected:
 
 namespace PCGExPathCrossings
 {
+	class FBatch;
+
 	class FProcessor final : public PCGExPointsMT::TProcessor<FPCGExPathCrossingsContext, UPCGExPathCrossingsSettings>
 	{
+		friend class FBatch;
+
 		bool bClosedLoop = false;
 		bool bSelfIntersectionOnly = false;
 		bool bCanCut = true;
@@ -230,4 +239,24 @@ namespace PCGExPathCrossings
 
 		virtual void Write() override;
 	};
+
+	class FBatch final : public PCGExPointsMT::TBatch<FProcessor>
+	{
+		friend class FProcessor;
+
+		// Cutter paths, indexed by processor BatchIndex; null if the processor can't cut
+		TArray<TSharedPtr<PCGExPaths::FPath>> CutterPaths;
+
+		// Flat cutter edge references, H64(BatchIndex, EdgeIndex), indexed by EdgeBVH payloads
+		TArray<uint64> CutterEdges;
+
+		TSharedPtr<PCGExBVH::FBVH> EdgeBVH; // All cutter edges across the batch
+		TSharedPtr<PCGExBVH::FBVH> PathBVH; // Cutter paths bounds, payload is BatchIndex
+
+	public:
+		explicit FBatch(FPCGExContext* InContext, const TArray<TWeakPtr<PCGExData::FPointIO>>& InPointsCollection);
+
+	protected:
+		virtual void OnInitialPostProcess() override;
+	};
 }
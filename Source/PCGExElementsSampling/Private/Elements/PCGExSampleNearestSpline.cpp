@@ -8,9 +8,11 @@
 #include "Data/PCGExDataTags.h"
 #include "Data/PCGExPointIO.h"
 #include "Details/PCGExSettingsDetails.h"
+#include "Math/PCGExBVH.h"
 #include "Math/PCGExMathDistances.h"
 #include "Sampling/PCGExSamplingHelpers.h"
 #include "Types/PCGExTypes.h"
+#include "Async/ParallelFor.h"
 
 #define LOCTEXT_NAMESPACE "PCGExSampleNearestSplineElement"
 #define PCGEX_NAMESPACE SampleNearestPolyLine
@@ -39,6 +41,110 @@ namespace PCGExPolyPath
 
 		SampledRangeWidth = SampledRangeMax - SampledRangeMin;
 	}
+
+	void FSegmentTree::Build(const FPCGSplineStruct& InSpline, const int32 InSubdivisions)
+	{
+		const FInterpCurveVector& Curve = InSpline.GetSplinePointsPosition();
+		const int32 NumSegments = InSpline.GetNumberOfSplineSegments();
+		const int32 NumPoints = Curve.Points.Num();
+
+		Subdivisions = FMath::Max(1, InSubdivisions);
+
+		const int32 NumSubSegments = NumSegments * Subdivisions;
+		const double Step = 1.0 / static_cast<double>(Subdivisions);
+
+		// Spline input keys map 1:1 to point indices, so sub-segment i always lies within spline segment i / Subdivisions
+		Positions.SetNumUninitialized(NumSubSegments + 1);
+		for (int32 i = 0; i <= NumSubSegments; i++) { Positions[i] = Curve.Eval(static_cast<float>(i * Step)); }
+
+		Bounds.SetNumUninitialized(NumSubSegments);
+
+		TArray<PCGExBVH::FItem> Items;
+		Items.SetNumUninitialized(NumSubSegments);
+
+		for (int32 Segment = 0; Segment < NumSegments; Segment++)
+		{
+			const FInterpCurvePoint<FVector>& From = Curve.Points[Segment];
+			const FInterpCurvePoint<FVector>& To = Curve.Points[(Segment + 1) % NumPoints];
+
+			// Derivative of the segment's Hermite form with respect to its local alpha
+			auto Derivative = [&](const double Alpha) -> FVector
+			{
+				if (From.InterpMode == CIM_Constant) { return FVector::ZeroVector; }
+				if (From.InterpMode == CIM_Linear) { return To.OutVal - From.OutVal; }
+
+				const double A2 = Alpha * Alpha;
+				return (6 * A2 - 6 * Alpha) * From.OutVal + (3 * A2 - 4 * Alpha + 1) * From.LeaveTangent
+					+ (6 * Alpha - 6 * A2) * To.OutVal + (3 * A2 - 2 * Alpha) * To.ArriveTangent;
+			};
+
+			for (int32 Sub = 0; Sub < Subdivisions; Sub++)
+			{
+				const int32 i = Segment * Subdivisions + Sub;
+				const FVector& A = Positions[i];
+				const FVector& B = Positions[i + 1];
+
+				// Bezier control points of the curve restricted to [Sub, Sub + 1] * Step
+				FBox Box(ForceInit);
+				Box += A;
+				Box += B;
+				Box += A + Derivative(Sub * Step) * (Step / 3);
+				Box += B - Derivative((Sub + 1) * Step) * (Step / 3);
+
+				Bounds[i] = Box;
+				Items[i] = PCGExBVH::FItem(Box, i);
+			}
+		}
+
+		BVH = MakeShared<PCGExBVH::FBVH>();
+		BVH->Build(MoveTemp(Items));
+	}
+
+	double FSegmentTree::FindInputKeyClosest(const FPCGSplineStruct& InSpline, const FVector& InWorldLocation) const
+	{
+		// Same space as FindInputKeyClosestToWorldLocation so results match
+		const FVector Local = InSpline.GetTransform().InverseTransformPosition(InWorldLocation);
+
+		auto SubSegmentDistSquared = [&](const int32 Index) { return FMath::PointDistToSegmentSquared(Local, Positions[Index], Positions[Index + 1]); };
+
+		double BestDistSquared = MAX_dbl;
+		const int32 BestSubSegment = BVH->FindNearest(Local, SubSegmentDistSquared, BestDistSquared);
+		if (BestSubSegment == -1) { return InSpline.FindInputKeyClosestToWorldLocation(InWorldLocation); }
+
+		const FInterpCurveVector& Curve = InSpline.GetSplinePointsPosition();
+
+		// The chord may stray from the curve, its end points don't: they give an upper bound on the true closest distance
+		const double ReachSquared = FMath::Min(FVector::DistSquared(Local, Positions[BestSubSegment]), FVector::DistSquared(Local, Positions[BestSubSegment + 1]));
+		const double Reach = FMath::Sqrt(ReachSquared);
+
+		// Any sub-segment whose hull is within reach may hold the true closest point
+		TArray<int32, TInlineAllocator<8>> Segments;
+		BVH->FindElementsWithBoundsTest(
+			FBox(Local - FVector(Reach), Local + FVector(Reach)),
+			[&](const int32 Index)
+			{
+				if (Bounds[Index].ComputeSquaredDistanceToPoint(Local) > ReachSquared) { return; }
+				Segments.AddUnique(Index / Subdivisions);
+			});
+
+		if (Segments.IsEmpty()) { Segments.Add(BestSubSegment / Subdivisions); }
+
+		// Exact refinement only on the surviving segments
+		float BestKey = 0;
+		float ClosestDistSquared = MAX_flt;
+		for (const int32 Segment : Segments)
+		{
+			float DistSquared = 0;
+			const float Key = Curve.FindNearestOnSegment(Local, Segment, DistSquared);
+			if (DistSquared < ClosestDistSquared)
+			{
+				ClosestDistSquared = DistSquared;
+				BestKey = Key;
+			}
+		}
+
+		return BestKey;
+	}
 }
 
 UPCGExSampleNearestSplineSettings::UPCGExSampleNearestSplineSettings(const FObjectInitializer& ObjectInitializer)
@@ -153,6 +259,15 @@ bool FPCGExSampleNearestSplineElement::Boot(FPCGExContext* InContext) const
 		for (int i = 0; i < Context->NumTargets; i++) { Context->SplineOctree->AddElement(PCGExOctree::FItem(i, SplineBounds[i])); }
 	}
 
+	if (Settings->bUseSegmentBVH && !Settings->bSampleSpecificAlpha)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExSampleNearestSplineElement::BuildSegmentTrees);
+
+		const int32 Subdivisions = Settings->SegmentBVHSubdivisions;
+		Context->SegmentTrees.SetNum(Context->NumTargets);
+		ParallelFor(Context->NumTargets, [&](const int32 i) { Context->SegmentTrees[i].Build(Context->Splines[i], Subdivisions); });
+	}
+
 	PCGEX_FOREACH_FIELD_NEARESTPOLYLINE(PCGEX_OUTPUT_VALIDATE_NAME)
 
 	Context->bComputeTangents = Settings->bWriteArriveTangent || Settings->bWriteLeaveTangent;
@@ -437,7 +552,9 @@ namespace PCGExSampleNearestSpline
 				auto ProcessClosestAlpha = [&](const int32 TargetIndex)
 				{
 					const FPCGSplineStruct& Line = Context->Splines[TargetIndex];
-					const double Time = Line.FindInputKeyClosestToWorldLocation(Origin);
+					const double Time = Context->SegmentTrees.IsEmpty() ?
+						                    Line.FindInputKeyClosestToWorldLocation(Origin) :
+						                    Context->SegmentTrees[TargetIndex].FindInputKeyClosest(Line, Origin);
 					ProcessTarget(Line.GetTransformAtSplineInputKey
 					              (static_cast<float>(Time), ESplineCoordinateSpace::World, Settings->bSplineScalesRanges),
 					              Time, Context->SegmentCounts[TargetIndex], Line);
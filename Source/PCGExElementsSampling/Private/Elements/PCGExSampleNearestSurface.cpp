@@ -111,6 +111,10 @@ bool FPCGExSampleNearestSurfaceElement::Boot(FPCGExContext* InContext) const
 		}
 	}
 
+	// Snapshot included primitive bounds once so points can skip far away primitives cheaply
+	Context->IncludedCandidates.Reserve(Context->IncludedPrimitives.Num());
+	for (UPrimitiveComponent* Primitive : Context->IncludedPrimitives) { if (IsValid(Primitive)) { Context->IncludedCandidates.Emplace(Primitive); } }
+
 	Context->CollisionSettings = Settings->CollisionSettings;
 	Context->CollisionSettings.Init(Context);
 
@@ -221,6 +225,28 @@ namespace PCGExSampleNearestSurface
 			//PCGEX_OUTPUT_VALUE(PhysMat, Index, TEXT(""))
 		};
 
+		// Batched mode : nearby points share a single broad-phase scene query and only resolve against its results
+		const bool bBatched = Settings->bBatchQueries && !Context->bUseInclude;
+		TArray<int32> PointGroups;
+		TArray<TArray<PCGExCollision::FCandidate>> GroupCandidates;
+
+		if (bBatched)
+		{
+			PCGExCollision::FQueryGroups QueryGroups(Settings->BatchCellSize);
+			PointGroups.Init(-1, Scope.Count);
+
+			PCGEX_SCOPE_LOOP(Index)
+			{
+				if (!PointFilterCache[Index]) { continue; }
+
+				const double MaxDistance = DistanceGetter->Read(Index);
+				const FVector Origin = InTransforms[Index].GetLocation();
+				PointGroups[Index - Scope.Start] = QueryGroups.Add(Index, FBox(Origin - FVector(MaxDistance), Origin + FVector(MaxDistance)));
+			}
+
+			GroupCandidates.SetNum(QueryGroups.Groups.Num());
+			for (int32 i = 0; i < GroupCandidates.Num(); i++) { Context->CollisionSettings.GatherCandidates(QueryGroups.Groups[i].Bounds, GroupCandidates[i]); }
+		}
 
 		PCGEX_SCOPE_LOOP(Index)
 		{
@@ -243,28 +269,35 @@ namespace PCGExSampleNearestSurface
 			const int32* HitIndex = nullptr;
 			bool bSuccess = false;
 			TArray<FOverlapResult> OutOverlaps;
+			TArray<UPrimitiveComponent*, TInlineAllocator<16>> Components;
 
 			auto ProcessOverlapResults = [&]()
 			{
+				if (Components.IsEmpty())
+				{
+					for (const FOverlapResult& Overlap : OutOverlaps) { if (UPrimitiveComponent* Component = Overlap.Component.Get()) { Components.Add(Component); } }
+				}
+
 				float MinDist = MAX_FLT;
 				UPrimitiveComponent* HitComp = nullptr;
-				for (const FOverlapResult& Overlap : OutOverlaps)
+				for (UPrimitiveComponent* Component : Components)
 				{
-					//if (!Overlap.bBlockingHit) { continue; }
-					if (!Context->IncludedActors.IsEmpty() && !Context->IncludedActors.Contains(Overlap.GetActor())) { continue; }
+					AActor* Owner = Component->GetOwner();
+					if (!Context->IncludedActors.IsEmpty() && !Context->IncludedActors.Contains(Owner)) { continue; }
 
 					FVector OutClosestLocation;
-					const float Distance = Overlap.Component->GetClosestPointOnCollision(Origin, OutClosestLocation);
+					const float Distance = Component->GetClosestPointOnCollision(Origin, OutClosestLocation);
 
-					if (Distance < 0) { continue; }
+					// Batched candidates come from a coarser query, so they're not guaranteed to be in range
+					if (Distance < 0 || (bBatched && Distance > MaxDistance)) { continue; }
 
 					if (Distance < MinDist)
 					{
-						HitIndex = Context->IncludedActors.Find(Overlap.GetActor());
+						HitIndex = Context->IncludedActors.Find(Owner);
 						MinDist = Distance;
 						HitLocation = OutClosestLocation;
 						bSuccess = true;
-						HitComp = Overlap.Component.Get();
+						HitComp = Component;
 					}
 				}
 
@@ -333,11 +366,25 @@ namespace PCGExSampleNearestSurface
 			};
 
 
-			if (Context->bUseInclude)
+			if (bBatched)
+			{
+				const double MaxDistanceSquared = FMath::Square(MaxDistance);
+				for (const PCGExCollision::FCandidate& Candidate : GroupCandidates[PointGroups[Index - Scope.Start]])
+				{
+					if (!IsValid(Candidate.Component) || Candidate.Bounds.ComputeSquaredDistanceToPoint(Origin) > MaxDistanceSquared) { continue; }
+					Components.Add(Candidate.Component);
+				}
+
+				if (Components.IsEmpty()) { SamplingFailed(Index, MaxDistance); }
+				else { ProcessOverlapResults(); }
+			}
+			else if (Context->bUseInclude)
 			{
-				for (const UPrimitiveComponent* Primitive : Context->IncludedPrimitives)
+				const double MaxDistanceSquared = FMath::Square(MaxDistance);
+				for (const PCGExCollision::FCandidate& Candidate : Context->IncludedCandidates)
 				{
-					if (!IsValid(Primitive)) { continue; }
+					const UPrimitiveComponent* Primitive = Candidate.Component;
+					if (!IsValid(Primitive) || Candidate.Bounds.ComputeSquaredDistanceToPoint(Origin) > MaxDistanceSquared) { continue; }
 					if (TArray<FOverlapResult> TempOverlaps; Primitive->OverlapComponentWithResult(Origin, FQuat::Identity, CollisionShape, TempOverlaps))
 					{
 						OutOverlaps.Append(TempOverlaps);
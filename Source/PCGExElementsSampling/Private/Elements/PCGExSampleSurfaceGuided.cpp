@@ -114,6 +114,10 @@ bool FPCGExSampleSurfaceGuidedElement::Boot(FPCGExContext* InContext) const
 		}
 	}
 
+	// Snapshot included primitive bounds once so traces can skip primitives they can't reach
+	Context->IncludedCandidates.Reserve(Context->IncludedPrimitives.Num());
+	for (UPrimitiveComponent* Primitive : Context->IncludedPrimitives) { if (IsValid(Primitive)) { Context->IncludedCandidates.Emplace(Primitive); } }
+
 	Context->bSupportsUVQuery = UPhysicsSettings::Get()->bSupportUVFromHitResults;
 	if (Settings->bWriteUVCoords && !Context->bSupportsUVQuery)
 	{
@@ -330,6 +334,71 @@ namespace PCGExSampleSurfaceGuided
 		FPlatformAtomics::InterlockedExchange(&bAnySuccess, 1);
 	}
 
+	bool FProcessor::TraceCandidates(const int32 Index, const FVector& Origin, const FVector& End, const FCollisionQueryParams& CollisionParams, const TArray<PCGExCollision::FCandidate>& Candidates, const bool bBatched, FHitResult& OutHit) const
+	{
+		FCollisionShape Shape;
+		FVector ShapeExtent = FVector::ZeroVector;
+
+		switch (Context->CollisionSettings.TraceMode)
+		{
+		case EPCGExTraceMode::Sphere:
+			Shape = FCollisionShape::MakeSphere(SphereRadiusGetter->Read(Index));
+			ShapeExtent = FVector(Shape.GetSphereRadius());
+			break;
+		case EPCGExTraceMode::Box:
+			Shape = FCollisionShape::MakeBox(BoxHalfExtentsGetter->Read(Index));
+			ShapeExtent = Shape.GetBox();
+			break;
+		default: break;
+		}
+
+		const FVector Delta = End - Origin;
+		double ClosestDistSq = MAX_dbl;
+		bool bSuccess = false;
+
+		for (const PCGExCollision::FCandidate& Candidate : Candidates)
+		{
+			UPrimitiveComponent* Primitive = Candidate.Component;
+			if (!IsValid(Primitive)) { continue; }
+
+			if (bBatched)
+			{
+				// Batched candidates are gathered for the whole group; mimic scene query filtering
+				if (Context->bUseInclude) { if (!Context->IncludedActors.Contains(Primitive->GetOwner())) { continue; } }
+				else if (!Candidate.bBlocking) { continue; }
+			}
+
+			if (!FMath::LineBoxIntersection(Candidate.Bounds.ExpandBy(ShapeExtent), Origin, End, Delta)) { continue; }
+
+			FHitResult TempHit;
+			bool bHit = false;
+
+			switch (Context->CollisionSettings.TraceMode)
+			{
+			case EPCGExTraceMode::Line:
+				bHit = Primitive->LineTraceComponent(TempHit, Origin, End, CollisionParams);
+				break;
+			case EPCGExTraceMode::Sphere:
+			case EPCGExTraceMode::Box:
+				bHit = Primitive->SweepComponent(TempHit, Origin, End, FQuat::Identity, Shape, CollisionParams.bTraceComplex);
+				break;
+			}
+
+			if (bHit)
+			{
+				const double DistSq = FVector::DistSquared(Origin, TempHit.ImpactPoint);
+				if (DistSq < ClosestDistSq)
+				{
+					ClosestDistSq = DistSq;
+					OutHit = TempHit;
+					bSuccess = true;
+				}
+			}
+		}
+
+		return bSuccess;
+	}
+
 	void FProcessor::ProcessPoints(const PCGExMT::FScope& Scope)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(PCGEx::SampleSurfaceGuided::ProcessPoints);
@@ -341,6 +410,37 @@ namespace PCGExSampleSurfaceGuided
 
 		double DirMult = Settings->bInvertDirection ? -1 : 1;
 
+		// Batched mode : nearby traces share a single broad-phase scene query and only resolve against its results
+		const bool bBatched = Settings->bBatchQueries && Settings->SurfaceSource != EPCGExSurfaceSource::Primitives;
+		TArray<int32> PointGroups;
+		TArray<TArray<PCGExCollision::FCandidate>> GroupCandidates;
+
+		if (bBatched)
+		{
+			PCGExCollision::FQueryGroups QueryGroups(Settings->BatchCellSize);
+			PointGroups.Init(-1, Scope.Count);
+
+			PCGEX_SCOPE_LOOP(Index)
+			{
+				if (!PointFilterCache[Index]) { continue; }
+
+				const FVector Origin = OriginGetter->Read(Index);
+				const FVector End = Origin + DirectionGetter->Read(Index).GetSafeNormal() * DirMult * DistanceGetter->Read(Index);
+
+				FBox TraceBounds(ForceInit);
+				TraceBounds += Origin;
+				TraceBounds += End;
+
+				if (SphereRadiusGetter) { TraceBounds = TraceBounds.ExpandBy(SphereRadiusGetter->Read(Index)); }
+				else if (BoxHalfExtentsGetter) { TraceBounds = TraceBounds.ExpandBy(BoxHalfExtentsGetter->Read(Index).GetAbs().GetMax()); }
+
+				PointGroups[Index - Scope.Start] = QueryGroups.Add(Index, TraceBounds);
+			}
+
+			GroupCandidates.SetNum(QueryGroups.Groups.Num());
+			for (int32 i = 0; i < GroupCandidates.Num(); i++) { Context->CollisionSettings.GatherCandidates(QueryGroups.Groups[i].Bounds, GroupCandidates[i]); }
+		}
+
 		PCGEX_SCOPE_LOOP(Index)
 		{
 			const FVector Direction = DirectionGetter->Read(Index).GetSafeNormal() * DirMult;
@@ -386,49 +486,10 @@ namespace PCGExSampleSurfaceGuided
 			FHitResult HitResult;
 			TArray<FHitResult> HitResults;
 
-			if (Settings->SurfaceSource == EPCGExSurfaceSource::Primitives)
+			if (bBatched || Settings->SurfaceSource == EPCGExSurfaceSource::Primitives)
 			{
-				double ClosestDistSq = MAX_dbl;
-
-				for (UPrimitiveComponent* Primitive : Context->IncludedPrimitives)
-				{
-					if (!IsValid(Primitive)) { continue; }
-
-					FHitResult TempHit;
-					bool bHit = false;
-
-					switch (Context->CollisionSettings.TraceMode)
-					{
-					case EPCGExTraceMode::Line:
-						bHit = Primitive->LineTraceComponent(TempHit, Origin, End, CollisionParams);
-						break;
-					case EPCGExTraceMode::Sphere:
-						{
-							const double Radius = SphereRadiusGetter->Read(Index);
-							const FCollisionShape Shape = FCollisionShape::MakeSphere(Radius);
-							bHit = Primitive->SweepComponent(TempHit, Origin, End, FQuat::Identity, Shape, CollisionParams.bTraceComplex);
-						}
-						break;
-					case EPCGExTraceMode::Box:
-						{
-							const FVector HalfExtents = BoxHalfExtentsGetter->Read(Index);
-							const FCollisionShape Shape = FCollisionShape::MakeBox(HalfExtents);
-							bHit = Primitive->SweepComponent(TempHit, Origin, End, FQuat::Identity, Shape, CollisionParams.bTraceComplex);
-						}
-						break;
-					}
-
-					if (bHit)
-					{
-						const double DistSq = FVector::DistSquared(Origin, TempHit.ImpactPoint);
-						if (DistSq < ClosestDistSq)
-						{
-							ClosestDistSq = DistSq;
-							HitResult = TempHit;
-							bSuccess = true;
-						}
-					}
-				}
+				const TArray<PCGExCollision::FCandidate>& Candidates = bBatched ? GroupCandidates[PointGroups[Index - Scope.Start]] : Context->IncludedCandidates;
+				bSuccess = TraceCandidates(Index, Origin, End, CollisionParams, Candidates, bBatched, HitResult);
 
 				if (bSuccess) { ProcessTraceResult(Scope, HitResult, Index, Origin, Direction, MutablePoint); }
 				if (!bSuccess) { SamplingFailed(); }
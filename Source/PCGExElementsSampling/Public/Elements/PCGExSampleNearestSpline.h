@@ -40,6 +40,11 @@ MACRO(TotalWeight, double, 0)
 
 class UPCGExPointFilterFactoryData;
 
+namespace PCGExBVH
+{
+	class FBVH;
+}
+
 namespace PCGExMT
 {
 	template <typename T>
@@ -103,6 +108,26 @@ namespace PCGExPolyPath
 		FORCEINLINE double GetRangeRatio(const double Distance) const { return FMath::Clamp(Distance - SampledRangeMin, 0, SampledRangeWidth) / SampledRangeWidth; }
 		FORCEINLINE bool IsValid() const { return UpdateCount > 0; }
 	};
+
+	/**
+	 * Tessellated, spline-local polyline approximation indexed by a BVH.
+	 * Used to find the closest spline segment without evaluating every segment, then refine only the winner(s) exactly.
+	 * Each sub-segment is bounded by the convex hull of its cubic control points, which always contains that piece of curve:
+	 * a sub-segment whose hull bounds are farther than a point known to be on the curve can't hold the closest point,
+	 * so pruning never drops the segment the full search would have picked.
+	 */
+	struct FSegmentTree
+	{
+		TArray<FVector> Positions; // NumSegments * Subdivisions + 1 positions on the curve, in spline local space
+		TArray<FBox> Bounds;       // Per sub-segment control-point hull bounds
+		int32 Subdivisions = 1;
+		TSharedPtr<PCGExBVH::FBVH> BVH;
+
+		void Build(const FPCGSplineStruct& InSpline, const int32 InSubdivisions);
+
+		/** Drop-in replacement for FPCGSplineStruct::FindInputKeyClosestToWorldLocation */
+		double FindInputKeyClosest(const FPCGSplineStruct& InSpline, const FVector& InWorldLocation) const;
+	};
 }
 
 /**
@@ -457,6 +482,14 @@ public:
 	/** Optimize spatial partitioning, but limit the "reach" of splines to their bounding box. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable), AdvancedDisplay)
 	bool bUseOctree = true;
+
+	/** Build a per-spline segment BVH from a tessellated approximation, and only run the exact closest-point refinement on the winning segment(s). Significantly faster on long splines with many points. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Performance, meta=(PCG_NotOverridable, AdvancedDisplay))
+	bool bUseSegmentBVH = true;
+
+	/** Number of linear sub-segments per spline segment used to build the BVH approximation. Higher values tighten culling on very curvy splines, at the cost of build time. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Performance, meta=(PCG_NotOverridable, AdvancedDisplay, EditCondition="bUseSegmentBVH", ClampMin=1, ClampMax=64))
+	int32 SegmentBVHSubdivisions = 8;
 };
 
 struct FPCGExSampleNearestSplineContext final : FPCGExPointsProcessorContext
@@ -473,6 +506,8 @@ struct FPCGExSampleNearestSplineContext final : FPCGExPointsProcessorContext
 	FBox OctreeBounds = FBox(ForceInit);
 	TSharedPtr<PCGExOctree::FItemOctree> SplineOctree;
 
+	TArray<PCGExPolyPath::FSegmentTree> SegmentTrees;
+
 	int64 NumTargets = 0;
 
 	PCGExFloatLUT WeightCurve = nullptr;
@@ -214,6 +214,14 @@ public:
 	/** Consider points that are outside as failed samples. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable), AdvancedDisplay)
 	bool bProcessOutsideAsFailedSamples = false;
+
+	/** Group nearby points and gather their candidate primitives with a single scene query per group, then resolve each point against those candidates only. Greatly reduces physics scene traffic on dense inputs. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Performance, meta=(PCG_NotOverridable, AdvancedDisplay))
+	bool bBatchQueries = false;
+
+	/** Size of the grid cells used to group points together. Larger cells mean fewer scene queries but more candidates per point. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Performance, meta=(PCG_NotOverridable, AdvancedDisplay, EditCondition="bBatchQueries", ClampMin=1))
+	double BatchCellSize = 2000;
 };
 
 struct FPCGExSampleNearestSurfaceContext final : FPCGExPointsProcessorContext
@@ -229,6 +237,7 @@ struct FPCGExSampleNearestSurfaceContext final : FPCGExPointsProcessorContext
 	bool bUseInclude = false;
 	TMap<AActor*, int32> IncludedActors;
 	TArray<UPrimitiveComponent*> IncludedPrimitives;
+	TArray<PCGExCollision::FCandidate> IncludedCandidates;
 
 	PCGEX_FOREACH_FIELD_NEARESTSURFACE(PCGEX_OUTPUT_DECL_TOGGLE)
 
@@ -305,6 +305,14 @@ public:
 	/** Suppress warnings about UV query settings not being enabled in project settings. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Warnings and Errors")
 	bool bQuietUVSettingsWarning = false;
+
+	/** Group nearby points and gather their candidate primitives with a single scene query per group, then resolve each point against those candidates only. Greatly reduces physics scene traffic on dense inputs. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Performance, meta=(PCG_NotOverridable, AdvancedDisplay))
+	bool bBatchQueries = false;
+
+	/** Size of the grid cells used to group points together. Larger cells mean fewer scene queries but more candidates per point. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Performance, meta=(PCG_NotOverridable, AdvancedDisplay, EditCondition="bBatchQueries", ClampMin=1))
+	double BatchCellSize = 2000;
 };
 
 struct FPCGExSampleSurfaceGuidedContext final : FPCGExPointsProcessorContext
@@ -319,6 +327,7 @@ struct FPCGExSampleSurfaceGuidedContext final : FPCGExPointsProcessorContext
 
 	TMap<AActor*, int32> IncludedActors;
 	TArray<UPrimitiveComponent*> IncludedPrimitives;
+	TArray<PCGExCollision::FCandidate> IncludedCandidates;
 
 	FPCGExCollisionDetails CollisionSettings;
 
@@ -385,6 +394,9 @@ namespace PCGExSampleSurfaceGuided
 
 		void ProcessTraceResult(const PCGExMT::FScope& Scope, const FHitResult& HitResult, const int32 Index, const FVector& Origin, const FVector& Direction, PCGExData::FMutablePoint& MutablePoint);
 
+		/** Trace against each candidate primitive whose bounds the query can reach, and keep the closest hit. */
+		bool TraceCandidates(const int32 Index, const FVector& Origin, const FVector& End, const FCollisionQueryParams& CollisionParams, const TArray<PCGExCollision::FCandidate>& Candidates, const bool bBatched, FHitResult& OutHit) const;
+
 		virtual void ProcessPoints(const PCGExMT::FScope& Scope) override;
 
 		void GetVertexColorAtHit(const int32 Index, FVector4& OutColor) const;
@@ -161,6 +161,9 @@ void FPCGExClipper2TriangulateContext::Process(const TSharedPtr<PCGExClipper2::F
 		return;
 	}
 
+	// Intersections recorded by the ZCallback are only searchable once frozen
+	Group->FreezeIntersections();
+
 	// Helper lambda to find or create vertex index
 	auto FindOrCreateVertexIndex = [&](const PCGExClipper2Lib::Point64& Pt) -> int32
 	{
@@ -18,25 +18,23 @@ namespace PCGEx
 
 		if (Action == EPCGExTagsToDataAction::ToData)
 		{
-			for (const TPair<FString, TSharedPtr<PCGExData::IDataValue>>& ValueTag : Tags->ValueTags)
+			for (const PCGExData::FValueTag& ValueTag : Tags->GetValueTags_Unsafe())
 			{
-				PCGExMetaHelpers::ExecuteWithRightType(ValueTag.Value->GetTypeId(), [&](auto DummyValue)
+				PCGExMetaHelpers::ExecuteWithRightType(ValueTag.Value.Type, [&](auto DummyValue)
 				{
 					using T = decltype(DummyValue);
-					TSharedPtr<PCGExData::TDataValue<T>> TypedValue = StaticCastSharedPtr<PCGExData::TDataValue<T>>(ValueTag.Value);
-					PCGExData::Helpers::SetDataValue<T>(Data, FName(ValueTag.Key), TypedValue->Value);
+					PCGExData::Helpers::SetDataValue<T>(Data, FName(PCGExData::FTagTable::ToString(ValueTag.Key)), ValueTag.Value.Get<T>());
 				});
 			}
 		}
 		else if (Action == EPCGExTagsToDataAction::ToElements)
 		{
-			for (const TPair<FString, TSharedPtr<PCGExData::IDataValue>>& ValueTag : Tags->ValueTags)
+			for (const PCGExData::FValueTag& ValueTag : Tags->GetValueTags_Unsafe())
 			{
-				PCGExMetaHelpers::ExecuteWithRightType(ValueTag.Value->GetTypeId(), [&](auto DummyValue)
+				PCGExMetaHelpers::ExecuteWithRightType(ValueTag.Value.Type, [&](auto DummyValue)
 				{
 					using T = decltype(DummyValue);
-					TSharedPtr<PCGExData::TDataValue<T>> TypedValue = StaticCastSharedPtr<PCGExData::TDataValue<T>>(ValueTag.Value);
-					Data->MutableMetadata()->FindOrCreateAttribute<T>(FName(ValueTag.Key), TypedValue->Value);
+					Data->MutableMetadata()->FindOrCreateAttribute<T>(FName(PCGExData::FTagTable::ToString(ValueTag.Key)), ValueTag.Value.Get<T>());
 				});
 			}
 		}
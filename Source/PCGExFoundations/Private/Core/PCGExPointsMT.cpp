@@ -3,6 +3,7 @@
 
 #include "Core/PCGExPointsMT.h"
 
+#include "Core/PCGExMT.h"
 
 #include "Factories/PCGExInstancedFactory.h"
 #include "Data/PCGExData.h"
@@ -247,6 +248,13 @@ namespace PCGExPointsMT
 			return;
 		}
 
+		{
+			TArray<int32> Costs;
+			Costs.Reserve(Processors.Num());
+			for (const TSharedRef<IProcessor>& P : Processors) { Costs.Add(P->PointDataFacade->GetNum()); }
+			PCGExMT::CoalesceWorkUnits(Costs, PCGEX_CORE_SETTINGS.SmallPointsSize, ProcessorUnitOrder, ProcessorUnits);
+		}
+
 		if (bPrefetchData)
 		{
 			PCGEX_ASYNC_GROUP_CHKD_VOID(TaskManager, ParallelAttributeRead)
@@ -282,12 +290,13 @@ namespace PCGExPointsMT
 
 	void IBatch::CompleteWork()
 	{
-		if (bSkipCompletion) { return; }
+		if (bSkipCompletion || bPipelinedPhases) { return; }
 		PCGEX_ASYNC_MT_LOOP_VALID_PROCESSORS(CompleteWork, bForceSingleThreadedCompletion, { Processor->CompleteWork(); }, {})
 	}
 
 	void IBatch::Write()
 	{
+		if (bPipelinedPhases) { return; }
 		PCGEX_ASYNC_MT_LOOP_VALID_PROCESSORS(Write, bForceSingleThreadedWrite, { Processor->Write(); }, {})
 	}
 
@@ -303,6 +312,9 @@ namespace PCGExPointsMT
 	void IBatch::Cleanup()
 	{
 		ProcessorFacades.Empty();
+		PipelineManagers.Empty();
+		ProcessorUnitOrder.Empty();
+		ProcessorUnits.Empty();
 
 		for (const TSharedRef<IProcessor>& P : Processors) { P->Cleanup(); }
 		Processors.Empty();
@@ -310,9 +322,119 @@ namespace PCGExPointsMT
 
 	void IBatch::OnProcessingPreparationComplete()
 	{
+		if (bPipelinedPhases)
+		{
+			StartPipelines();
+			return;
+		}
+
 		PCGEX_ASYNC_MT_LOOP_TPL(Process, bForceSingleThreadedProcessing, { Processor->bIsProcessorValid = Processor->Process(This->TaskManager); }, { Process->OnCompleteCallback = [PCGEX_ASYNC_THIS_CAPTURE](){ PCGEX_ASYNC_THIS This->OnInitialPostProcess(); };})
 	}
 
+	void IBatch::StartPipelines()
+	{
+		PCGEX_CHECK_WORK_HANDLE_VOID
+
+		// Keeps the batch task manager running until every processor is through its last phase
+		PipelineToken = TaskManager->TryCreateToken(FName("Pipelines"));
+		if (!PipelineToken.IsValid()) { return; }
+
+		const int32 NumProcessors = Processors.Num();
+
+		PipelineManagers.SetNum(NumProcessors);
+		PipelinePhases.Init(EPipelinePhase::Process, NumProcessors);
+		PendingPipelines.store(NumProcessors, std::memory_order_release);
+
+		for (int32 i = 0; i < NumProcessors; i++)
+		{
+			PCGEX_MAKE_SHARED(Manager, PCGExMT::FTaskManager, ExecutionContext)
+			Manager->WorkPriority = TaskManager->WorkPriority;
+
+			// A processor's manager ends once everything its current phase scheduled is done.
+			// Set once and never reassigned, since it may still be running when the next phase starts.
+			Manager->OnEndCallback = [PCGEX_ASYNC_THIS_CAPTURE, Index = i](const bool bWasCancelled)
+			{
+				PCGEX_ASYNC_THIS
+				const EPipelinePhase Current = This->PipelinePhases[Index];
+				This->SchedulePipelinePhase(Index, bWasCancelled ? EPipelinePhase::Done : static_cast<EPipelinePhase>(static_cast<uint8>(Current) + 1));
+			};
+
+			PipelineManagers[i] = Manager;
+		}
+
+		PCGEX_ASYNC_GROUP_CHKD_VOID(TaskManager, StartPipelines)
+		StartPipelines->OnIterationCallback = [PCGEX_ASYNC_THIS_CAPTURE](const int32 Index, const PCGExMT::FScope& Scope)
+		{
+			PCGEX_ASYNC_THIS
+			This->AdvancePipeline(Index, EPipelinePhase::Process);
+		};
+
+		StartPipelines->StartIterations(NumProcessors, 1, bForceSingleThreadedProcessing);
+	}
+
+	void IBatch::AdvancePipeline(const int32 Index, EPipelinePhase Phase)
+	{
+		const TSharedRef<IProcessor>& Processor = Processors[Index];
+		const TSharedPtr<PCGExMT::FTaskManager>& Manager = PipelineManagers[Index];
+
+		if (!WorkHandle.IsValid() || !Manager->IsAvailable()) { Phase = EPipelinePhase::Done; }
+
+		if (Phase == EPipelinePhase::CompleteWork && (bSkipCompletion || !Processor->bIsProcessorValid)) { Phase = EPipelinePhase::Write; }
+		if (Phase == EPipelinePhase::Write && (!bRequiresWriteStep || !Processor->bIsProcessorValid)) { Phase = EPipelinePhase::Done; }
+
+		if (Phase == EPipelinePhase::Done)
+		{
+			PipelinePhases[Index] = EPipelinePhase::Done;
+			if (PendingPipelines.fetch_sub(1, std::memory_order_acq_rel) == 1) { OnPipelinesComplete(); }
+			return;
+		}
+
+		PipelinePhases[Index] = Phase;
+
+		PCGEX_ASYNC_SCHEDULING_SCOPE_BODY(Manager)
+		{
+			AdvancePipeline(Index, EPipelinePhase::Done);
+			return;
+		}
+
+		switch (Phase)
+		{
+		case EPipelinePhase::Process:
+			Processor->bIsProcessorValid = Processor->Process(Manager);
+			break;
+		case EPipelinePhase::CompleteWork:
+			Processor->CompleteWork();
+			break;
+		case EPipelinePhase::Write:
+			Processor->Write();
+			break;
+		default:
+			break;
+		}
+	}
+
+	void IBatch::SchedulePipelinePhase(const int32 Index, const EPipelinePhase Phase)
+	{
+		// Hop through the batch task manager rather than chaining from inside the processor manager that just ended
+		PCGEX_ASYNC_GROUP_CHKD_VOID(TaskManager, PipelinePhase)
+		PipelinePhase->AddSimpleCallback(
+			[PCGEX_ASYNC_THIS_CAPTURE, Index, Phase]()
+			{
+				PCGEX_ASYNC_THIS
+				This->AdvancePipeline(Index, Phase);
+			});
+
+		PipelinePhase->StartSimpleCallbacks();
+	}
+
+	void IBatch::OnPipelinesComplete()
+	{
+		OnInitialPostProcess();
+
+		if (const TSharedPtr<PCGExMT::FAsyncToken> Token = PipelineToken.Pin()) { Token->Release(); }
+		PipelineToken.Reset();
+	}
+
 	void ScheduleBatch(const TSharedPtr<PCGExMT::FTaskManager>& TaskManager, const TSharedPtr<IBatch>& Batch)
 	{
 		PCGEX_LAUNCH(FStartBatchProcessing<IBatch>, Batch)
@@ -119,7 +119,7 @@ bool FPCGExPointsProcessorContext::ProcessPointsBatch(const PCGExCommon::Context
 		BatchProcessing_InitialProcessingDone();
 
 		SetState(PCGExPointsMT::MTState_PointsCompletingWork);
-		if (!MainBatch->bSkipCompletion)
+		if (!MainBatch->bSkipCompletion && !MainBatch->bPipelinedPhases)
 		{
 			PCGEX_ASYNC_SCHEDULING_SCOPE(GetTaskManager(), false)
 			MainBatch->CompleteWork();
@@ -135,14 +135,22 @@ bool FPCGExPointsProcessorContext::ProcessPointsBatch(const PCGExCommon::Context
 		if (MainBatch->bRequiresWriteStep)
 		{
 			SetState(PCGExPointsMT::MTState_PointsWriting);
-			PCGEX_ASYNC_SCHEDULING_SCOPE(GetTaskManager(), false)
-			MainBatch->Write();
-			return false;
+
+			// Pipelined batches have already written; fall through to the writing hook
+			if (!MainBatch->bPipelinedPhases)
+			{
+				PCGEX_ASYNC_SCHEDULING_SCOPE(GetTaskManager(), false)
+				MainBatch->Write();
+				return false;
+			}
+		}
+		else
+		{
+			bBatchProcessingEnabled = false;
+			if (NextStateId == PCGExCommon::States::State_Done) { Done(); }
+			SetState(NextStateId);
+			return true;
 		}
-		bBatchProcessingEnabled = false;
-		if (NextStateId == PCGExCommon::States::State_Done) { Done(); }
-		SetState(NextStateId);
-		return true;
 	}
 
 	PCGEX_ON_ASYNC_STATE_READY_INTERNAL(PCGExPointsMT::MTState_PointsWriting)
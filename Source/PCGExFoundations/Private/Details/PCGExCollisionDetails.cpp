@@ -8,11 +8,47 @@
 #include "GameFramework/Actor.h"
 #include "Engine/HitResult.h"
 #include "Engine/World.h"
+#include "Engine/OverlapResult.h"
+#include "Components/PrimitiveComponent.h"
 //#include "Engine/StaticMesh.h"
 //#include "Components/StaticMeshComponent.h"
 //#include "StaticMeshResources.h"
 #include "PCGComponent.h"
 #include "Core/PCGExContext.h"
+#include "PCGExH.h"
+
+namespace PCGExCollision
+{
+	FCandidate::FCandidate(UPrimitiveComponent* InComponent, const bool bInBlocking)
+		: Component(InComponent), Bounds(InComponent->Bounds.GetBox()), bBlocking(bInBlocking)
+	{
+	}
+
+	FQueryGroups::FQueryGroups(const double InCellSize)
+		: CellSize(FVector(FMath::Max(InCellSize, 1.0)))
+	{
+	}
+
+	int32 FQueryGroups::Add(const int32 Index, const FBox& InQueryBounds)
+	{
+		const uint64 Key = PCGEx::GH3(InQueryBounds.GetCenter(), CellSize);
+
+		int32 GroupIndex = -1;
+		if (const int32* ExistingIndex = CellMap.Find(Key)) { GroupIndex = *ExistingIndex; }
+		else
+		{
+			GroupIndex = Groups.Num();
+			CellMap.Add(Key, GroupIndex);
+			Groups.Emplace();
+		}
+
+		FGroup& Group = Groups[GroupIndex];
+		Group.Bounds += InQueryBounds;
+		Group.Indices.Add(Index);
+
+		return GroupIndex;
+	}
+}
 
 void FPCGExCollisionDetails::Init(FPCGExContext* InContext)
 {
@@ -201,3 +237,48 @@ bool FPCGExCollisionDetails::BoxSweepMulti(const FVector& From, const FVector& T
 	default: return false;
 	}
 }
+
+bool FPCGExCollisionDetails::OverlapMulti(const FVector& Center, const FCollisionShape& Shape, TArray<FOverlapResult>& OutOverlaps, const FQuat& Orientation) const
+{
+	FCollisionQueryParams CollisionParams;
+	Update(CollisionParams);
+
+	switch (CollisionType)
+	{
+	case EPCGExCollisionFilterType::Channel: return World->OverlapMultiByChannel(OutOverlaps, Center, Orientation, CollisionChannel, Shape, CollisionParams);
+	case EPCGExCollisionFilterType::ObjectType: return World->OverlapMultiByObjectType(OutOverlaps, Center, Orientation, FCollisionObjectQueryParams(CollisionObjectType), Shape, CollisionParams);
+	case EPCGExCollisionFilterType::Profile: return World->OverlapMultiByProfile(OutOverlaps, Center, Orientation, CollisionProfileName, Shape, CollisionParams);
+	default: return false;
+	}
+}
+
+bool FPCGExCollisionDetails::GatherCandidates(const FBox& InBounds, TArray<PCGExCollision::FCandidate>& OutCandidates) const
+{
+	OutCandidates.Reset();
+	if (!InBounds.IsValid) { return false; }
+
+	TArray<FOverlapResult> Overlaps;
+	if (!OverlapMulti(InBounds.GetCenter(), FCollisionShape::MakeBox(InBounds.GetExtent()), Overlaps)) { return false; }
+
+	// A single component may be reported once per body
+	TMap<const UPrimitiveComponent*, int32> Unique;
+	Unique.Reserve(Overlaps.Num());
+	OutCandidates.Reserve(Overlaps.Num());
+
+	for (const FOverlapResult& Overlap : Overlaps)
+	{
+		UPrimitiveComponent* Component = Overlap.Component.Get();
+		if (!IsValid(Component)) { continue; }
+
+		if (const int32* Existing = Unique.Find(Component))
+		{
+			OutCandidates[*Existing].bBlocking |= Overlap.bBlockingHit;
+			continue;
+		}
+
+		Unique.Add(Component, OutCandidates.Num());
+		OutCandidates.Emplace(Component, Overlap.bBlockingHit);
+	}
+
+	return !OutCandidates.IsEmpty();
+}
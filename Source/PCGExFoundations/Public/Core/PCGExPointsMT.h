@@ -17,6 +17,7 @@ namespace PCGExMT
 {
 	class FTaskManager;
 	class FTaskGroup;
+	class FAsyncToken;
 }
 
 namespace PCGEx
@@ -46,20 +47,15 @@ namespace PCGExPointsMT
 	PCGEX_CTX_STATE(MTState_PointsCompletingWork)
 	PCGEX_CTX_STATE(MTState_PointsWriting)
 
+// Iterates processor units rather than processors; small processors sharing a unit run back-to-back in the same task
 #define PCGEX_ASYNC_MT_LOOP_TPL(_ID, _INLINE_CONDITION, _BODY, _JIT)\
 	PCGEX_CHECK_WORK_HANDLE_VOID\
-	if (_INLINE_CONDITION)  { \
-		PCGEX_ASYNC_GROUP_CHKD_VOID(TaskManager, _ID) \
-		_ID->OnIterationCallback = [PCGEX_ASYNC_THIS_CAPTURE](const int32 Index, const PCGExMT::FScope& Scope) { PCGEX_ASYNC_THIS const TSharedRef<IProcessor>& Processor = This->Processors[Index]; _BODY }; \
-		_JIT\
-		_ID->StartIterations( Processors.Num(), 1, true);\
-	} else {\
-		PCGEX_ASYNC_GROUP_CHKD_VOID(TaskManager, _ID)\
-		_ID->OnIterationCallback = [PCGEX_ASYNC_THIS_CAPTURE](const int32 Index, const PCGExMT::FScope& Scope) { PCGEX_ASYNC_THIS \
-		const TSharedRef<IProcessor>& Processor = This->Processors[Index]; _BODY }; \
-		_JIT\
-		_ID->StartIterations(Processors.Num(), 1, false);\
-	}
+	PCGEX_ASYNC_GROUP_CHKD_VOID(TaskManager, _ID)\
+	_ID->OnIterationCallback = [PCGEX_ASYNC_THIS_CAPTURE](const int32 UnitIndex, const PCGExMT::FScope& Scope) { PCGEX_ASYNC_THIS \
+		const PCGExMT::FScope& Unit = This->ProcessorUnits[UnitIndex]; \
+		for (int32 UnitItem = Unit.Start; UnitItem < Unit.End; UnitItem++) { const TSharedRef<IProcessor>& Processor = This->Processors[This->ProcessorUnitOrder[UnitItem]]; _BODY } }; \
+	_JIT\
+	_ID->StartIterations(ProcessorUnits.Num(), 1, _INLINE_CONDITION);
 
 #define PCGEX_ASYNC_PROCESSOR_LOOP(_NAME, _NUM, _PREPARE, _PROCESS, _COMPLETE, _INLINE, _PLI) \
 	PCGEX_CHECK_WORK_HANDLE_VOID\
@@ -78,6 +74,14 @@ namespace PCGExPointsMT
 
 	class IBatch;
 
+	enum class EPipelinePhase : uint8
+	{
+		Process = 0,
+		CompleteWork,
+		Write,
+		Done
+	};
+
 	class PCGEXFOUNDATIONS_API IProcessor : public TSharedFromThis<IProcessor>
 	{
 		friend class IBatch;
@@ -204,6 +208,15 @@ namespace PCGExPointsMT
 		bool bForceSingleThreadedCompletion = false;
 		bool bForceSingleThreadedWrite = false;
 		bool bRequiresWriteStep = false;
+
+		/**
+		 * Opt-in. Each processor runs Process > CompleteWork > Write on its own task manager and moves to its next phase
+		 * as soon as its own work is done, instead of waiting on every other processor at each phase.
+		 * The only join left is the one before the context moves on; OnInitialPostProcess and the context phase hooks run there.
+		 * Processors must schedule all their work through their own TaskManager and must not rely on other processors having reached a phase.
+		 */
+		bool bPipelinedPhases = false;
+
 		PCGExData::EIOInit DataInitializationPolicy = PCGExData::EIOInit::NoInit;
 		TArray<TSharedRef<PCGExData::FFacade>> ProcessorFacades;
 		TMap<PCGExData::FPointIO*, TSharedRef<IProcessor>>* SubProcessorMap = nullptr;
@@ -222,6 +235,10 @@ namespace PCGExPointsMT
 		TArray<TSharedRef<IProcessor>> Processors;
 		int32 GetNumProcessors() const { return Processors.Num(); }
 
+		// Processors grouped by point count, see PCGExMT::CoalesceWorkUnits
+		TArray<int32> ProcessorUnitOrder;
+		TArray<PCGExMT::FScope> ProcessorUnits;
+
 		IBatch(FPCGExContext* InContext, const TArray<TWeakPtr<PCGExData::FPointIO>>& InPointsCollection);
 		virtual ~IBatch() = default;
 
@@ -253,6 +270,20 @@ namespace PCGExPointsMT
 
 	protected:
 		virtual void OnProcessingPreparationComplete();
+
+#pragma region Pipelined phases
+
+		TWeakPtr<PCGExMT::FAsyncToken> PipelineToken;
+		TArray<TSharedPtr<PCGExMT::FTaskManager>> PipelineManagers;
+		TArray<EPipelinePhase> PipelinePhases;
+		std::atomic<int32> PendingPipelines{0};
+
+		void StartPipelines();
+		void AdvancePipeline(const int32 Index, EPipelinePhase Phase);
+		void SchedulePipelinePhase(const int32 Index, const EPipelinePhase Phase);
+		virtual void OnPipelinesComplete();
+
+#pragma endregion
 	};
 
 	template <typename T>
@@ -12,8 +12,50 @@
 
 struct FPCGExContext;
 struct FHitResult;
+struct FOverlapResult;
+struct FCollisionShape;
 class UWorld;
 class AActor;
+class UPrimitiveComponent;
+
+namespace PCGExCollision
+{
+	/** A primitive gathered by a broad-phase query, along with a snapshot of its bounds for cheap per-query culling. */
+	struct PCGEXFOUNDATIONS_API FCandidate
+	{
+		UPrimitiveComponent* Component = nullptr;
+		FBox Bounds = FBox(ForceInit);
+		bool bBlocking = true;
+
+		FCandidate() = default;
+		FCandidate(UPrimitiveComponent* InComponent, const bool bInBlocking = true);
+	};
+
+	/**
+	 * Buckets queries into a coarse grid so that nearby queries can share a single broad-phase scene query,
+	 * instead of each one walking the physics scene on its own.
+	 */
+	class PCGEXFOUNDATIONS_API FQueryGroups
+	{
+	public:
+		struct FGroup
+		{
+			FBox Bounds = FBox(ForceInit);
+			TArray<int32> Indices;
+		};
+
+		TArray<FGroup> Groups;
+
+		explicit FQueryGroups(const double InCellSize);
+
+		/** Returns the group index the query was added to */
+		int32 Add(const int32 Index, const FBox& InQueryBounds);
+
+	protected:
+		FVector CellSize;
+		TMap<uint64, int32> CellMap;
+	};
+}
 
 UENUM()
 enum class EPCGExCollisionFilterType : uint8
@@ -108,4 +150,10 @@ struct PCGEXFOUNDATIONS_API FPCGExCollisionDetails
 	bool BoxSweep(const FVector& From, const FVector& To, const FVector& HalfExtents, FHitResult& HitResult, const FQuat& Orientation = FQuat::Identity) const;
 	bool BoxSweep(const FVector& From, const FVector& To, const FVector& HalfExtents, const FQuat& Orientation = FQuat::Identity) const;
 	bool BoxSweepMulti(const FVector& From, const FVector& To, const FVector& HalfExtents, TArray<FHitResult>& OutHits, const FQuat& Orientation = FQuat::Identity) const;
+
+	// Overlaps
+	bool OverlapMulti(const FVector& Center, const FCollisionShape& Shape, TArray<FOverlapResult>& OutOverlaps, const FQuat& Orientation = FQuat::Identity) const;
+
+	/** Gather every unique primitive overlapping the given box with a single scene query. */
+	bool GatherCandidates(const FBox& InBounds, TArray<PCGExCollision::FCandidate>& OutCandidates) const;
 };
@@ -7,6 +7,7 @@
 #include "Clusters/PCGExCluster.h"
 #include "Clusters/Artifacts/PCGExCell.h"
 #include "Math/PCGExBestFitPlane.h"
+#include "Math/PCGExBVH.h"
 #include "Math/PCGExMath.h"
 #include "Math/PCGExProjectionDetails.h"
 #include "Math/Geo/PCGExGeo.h"
@@ -55,13 +56,11 @@ namespace PCGExClusters
 		const int32 NumNodes = Nodes.Num();
 		const TArray<FVector2D>& Positions = *ProjectedPositions;
 
-		// Step 1: Create all half-edges (2 per edge)
+		// Step 1: Create all half-edges (2 per edge), A → B at 2 * EdgeIdx and its twin B → A right after
 		HalfEdges.Reset();
-		HalfEdges.Reserve(NumEdges * 2);
-		HalfEdgeMap.Reset();
-		HalfEdgeMap.Reserve(NumEdges * 2);
+		HalfEdges.SetNum(NumEdges * 2);
 
-		for (int32 EdgeIdx = 0; EdgeIdx < NumEdges; ++EdgeIdx)
+		ParallelFor(NumEdges, [&](const int32 EdgeIdx)
 		{
 			const FEdge& Edge = Edges[EdgeIdx];
 			// Edge.Start and Edge.End are POINT indices, convert to node indices
@@ -74,76 +73,27 @@ namespace PCGExClusters
 
 			// Half-edge A → B
 			const FVector2D DirAB = (PosB - PosA).GetSafeNormal();
-			const double AngleAB = FMath::Atan2(DirAB.Y, DirAB.X);
-			const int32 IndexAB = HalfEdges.Num();
-			HalfEdges.Emplace(NodeA, NodeB, AngleAB);
-			HalfEdgeMap.Add(PCGEx::H64(NodeA, NodeB), IndexAB);
+			const int32 IndexAB = EdgeIdx * 2;
+			HalfEdges[IndexAB] = FHalfEdge(NodeA, NodeB, FMath::Atan2(DirAB.Y, DirAB.X));
 
 			// Half-edge B → A
 			const FVector2D DirBA = (PosA - PosB).GetSafeNormal();
-			const double AngleBA = FMath::Atan2(DirBA.Y, DirBA.X);
-			const int32 IndexBA = HalfEdges.Num();
-			HalfEdges.Emplace(NodeB, NodeA, AngleBA);
-			HalfEdgeMap.Add(PCGEx::H64(NodeB, NodeA), IndexBA);
+			const int32 IndexBA = IndexAB + 1;
+			HalfEdges[IndexBA] = FHalfEdge(NodeB, NodeA, FMath::Atan2(DirBA.Y, DirBA.X));
 
 			// Link twins
 			HalfEdges[IndexAB].TwinIndex = IndexBA;
 			HalfEdges[IndexBA].TwinIndex = IndexAB;
-		}
-
-		// Step 2: For each vertex, collect and sort outgoing half-edges by angle
-		// Then link the "next" pointers
-		TArray<TArray<int32>> OutgoingByNode;
-		OutgoingByNode.SetNum(NumNodes);
-
-		// Collect outgoing half-edges for each node
-		for (int32 HEIdx = 0; HEIdx < HalfEdges.Num(); ++HEIdx)
-		{
-			const int32 Origin = HalfEdges[HEIdx].OriginNode;
-			OutgoingByNode[Origin].Add(HEIdx);
-		}
+		}, NumEdges < 1024);
 
-		// Sort each node's outgoing half-edges by angle (CCW order)
-		for (int32 NodeIdx = 0; NodeIdx < NumNodes; ++NodeIdx)
-		{
-			TArray<int32>& Outgoing = OutgoingByNode[NodeIdx];
-			if (Outgoing.Num() <= 1) { continue; }
-
-			// Sort by angle (ascending = CCW order)
-			Outgoing.Sort([this](const int32 A, const int32 B)
-			{
-				return HalfEdges[A].Angle < HalfEdges[B].Angle;
-			});
-		}
-
-		// Step 3: Link "next" pointers
-		// For half-edge (u → v), its "next" is the half-edge that comes after (v → u) in CCW order around v
-		for (int32 HEIdx = 0; HEIdx < HalfEdges.Num(); ++HEIdx)
-		{
-			FHalfEdge& HE = HalfEdges[HEIdx];
-			const int32 TargetNode = HE.TargetNode;
-			const int32 TwinIdx = HE.TwinIndex;
-
-			// Find where the twin (v → u) appears in v's sorted outgoing list
-			const TArray<int32>& TargetOutgoing = OutgoingByNode[TargetNode];
-			const int32 TwinPosInList = TargetOutgoing.Find(TwinIdx);
-
-			if (TwinPosInList == INDEX_NONE)
-			{
-				// Should never happen in a valid graph
-				HE.NextIndex = -1;
-				continue;
-			}
-
-			// The "next" half-edge is the one AFTER the twin in CCW order
-			// This gives us faces with interior on the LEFT (CCW traversal)
-			const int32 NextPosInList = (TwinPosInList + 1) % TargetOutgoing.Num();
-			HE.NextIndex = TargetOutgoing[NextPosInList];
-		}
+		// Steps 2 & 3: sort outgoing half-edges by angle & link "next" pointers
+		LinkHalfEdges(NumNodes);
 
 		NumFaces = 0;
 		bRawFacesEnumerated = false;
 		CachedRawFaces.Reset();
+		FaceBVH.Reset();
+		FacePolygons.Reset();
 	}
 
 	void FPlanarFaceEnumerator::Build(const TSharedRef<FCluster>& InCluster, const TSharedPtr<TArray<FQuat>>& InNodeTangentFrames)
@@ -164,11 +114,9 @@ namespace PCGExClusters
 
 		// Step 1: Create all half-edges with angles computed in origin node's local tangent frame
 		HalfEdges.Reset();
-		HalfEdges.Reserve(NumEdges * 2);
-		HalfEdgeMap.Reset();
-		HalfEdgeMap.Reserve(NumEdges * 2);
+		HalfEdges.SetNum(NumEdges * 2);
 
-		for (int32 EdgeIdx = 0; EdgeIdx < NumEdges; ++EdgeIdx)
+		ParallelFor(NumEdges, [&](const int32 EdgeIdx)
 		{
 			const FEdge& Edge = Edges[EdgeIdx];
 			const int32 NodeA = NodeLookup->Get(Edge.Start);
@@ -178,74 +126,89 @@ namespace PCGExClusters
 			const FVector PosB = Cluster->GetPos(NodeB);
 			const FVector EdgeDir3D = (PosB - PosA).GetSafeNormal();
 
+			const int32 IndexAB = EdgeIdx * 2;
+			const int32 IndexBA = IndexAB + 1;
+
 			// Half-edge A → B: project into NodeA's local frame
 			{
 				const FVector LocalDir = Frames[NodeA].UnrotateVector(EdgeDir3D);
-				const double AngleAB = FMath::Atan2(LocalDir.Y, LocalDir.X);
-				const int32 IndexAB = HalfEdges.Num();
-				HalfEdges.Emplace(NodeA, NodeB, AngleAB);
-				HalfEdgeMap.Add(PCGEx::H64(NodeA, NodeB), IndexAB);
+				HalfEdges[IndexAB] = FHalfEdge(NodeA, NodeB, FMath::Atan2(LocalDir.Y, LocalDir.X));
 			}
 
 			// Half-edge B → A: project into NodeB's local frame
 			{
 				const FVector LocalDir = Frames[NodeB].UnrotateVector(-EdgeDir3D);
-				const double AngleBA = FMath::Atan2(LocalDir.Y, LocalDir.X);
-				const int32 IndexBA = HalfEdges.Num();
-				HalfEdges.Emplace(NodeB, NodeA, AngleBA);
-				HalfEdgeMap.Add(PCGEx::H64(NodeB, NodeA), IndexBA);
+				HalfEdges[IndexBA] = FHalfEdge(NodeB, NodeA, FMath::Atan2(LocalDir.Y, LocalDir.X));
 			}
 
 			// Link twins
-			const int32 IndexAB = HalfEdges.Num() - 2;
-			const int32 IndexBA = HalfEdges.Num() - 1;
 			HalfEdges[IndexAB].TwinIndex = IndexBA;
 			HalfEdges[IndexBA].TwinIndex = IndexAB;
-		}
+		}, NumEdges < 1024);
 
-		// Step 2: Collect and sort outgoing half-edges by angle per node (same as global projection)
-		TArray<TArray<int32>> OutgoingByNode;
-		OutgoingByNode.SetNum(NumNodes);
+		// Steps 2 & 3: identical logic -- topology is topology
+		LinkHalfEdges(NumNodes);
 
-		for (int32 HEIdx = 0; HEIdx < HalfEdges.Num(); ++HEIdx)
+		NumFaces = 0;
+		bRawFacesEnumerated = false;
+		CachedRawFaces.Reset();
+		FaceBVH.Reset();
+		FacePolygons.Reset();
+	}
+
+	void FPlanarFaceEnumerator::LinkHalfEdges(const int32 NumNodes)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FPlanarFaceEnumerator::LinkHalfEdges);
+
+		const int32 NumHalfEdges = HalfEdges.Num();
+
+		HalfEdgeMap.Reset();
+		HalfEdgeMap.Reserve(NumHalfEdges);
+		for (int32 HEIdx = 0; HEIdx < NumHalfEdges; ++HEIdx)
 		{
-			OutgoingByNode[HalfEdges[HEIdx].OriginNode].Add(HEIdx);
+			const FHalfEdge& HE = HalfEdges[HEIdx];
+			HalfEdgeMap.Add(PCGEx::H64(HE.OriginNode, HE.TargetNode), HEIdx);
 		}
 
-		for (int32 NodeIdx = 0; NodeIdx < NumNodes; ++NodeIdx)
-		{
-			TArray<int32>& Outgoing = OutgoingByNode[NodeIdx];
-			if (Outgoing.Num() <= 1) { continue; }
+		// Step 2: Collect outgoing half-edges for each node, in half-edge order
+		// Flat per-node ranges: node N owns Outgoing[OutgoingStart[N] .. OutgoingStart[N + 1]]
+		TArray<int32> OutgoingStart;
+		OutgoingStart.Init(0, NumNodes + 1);
+		for (const FHalfEdge& HE : HalfEdges) { OutgoingStart[HE.OriginNode + 1]++; }
+		for (int32 NodeIdx = 0; NodeIdx < NumNodes; ++NodeIdx) { OutgoingStart[NodeIdx + 1] += OutgoingStart[NodeIdx]; }
 
-			Outgoing.Sort([this](const int32 A, const int32 B)
-			{
-				return HalfEdges[A].Angle < HalfEdges[B].Angle;
-			});
-		}
+		TArray<int32> Outgoing;
+		Outgoing.SetNumUninitialized(NumHalfEdges);
 
-		// Step 3: Link "next" pointers (identical logic -- topology is topology)
-		for (int32 HEIdx = 0; HEIdx < HalfEdges.Num(); ++HEIdx)
 		{
-			FHalfEdge& HE = HalfEdges[HEIdx];
-			const int32 TargetNode = HE.TargetNode;
-			const int32 TwinIdx = HE.TwinIndex;
+			TArray<int32> WriteIndex(OutgoingStart.GetData(), NumNodes);
+			for (int32 HEIdx = 0; HEIdx < NumHalfEdges; ++HEIdx) { Outgoing[WriteIndex[HalfEdges[HEIdx].OriginNode]++] = HEIdx; }
+		}
 
-			const TArray<int32>& TargetOutgoing = OutgoingByNode[TargetNode];
-			const int32 TwinPosInList = TargetOutgoing.Find(TwinIdx);
+		// Sort each node's outgoing half-edges by angle (ascending = CCW order), then
+		// link "next" pointers: for half-edge (u → v), its "next" is the half-edge that comes after (v → u) in CCW order around v.
+		// Every (u → v) is the twin of exactly one of v's outgoing half-edges, so each node links the twins of its own range.
+		ParallelFor(NumNodes, [&](const int32 NodeIdx)
+		{
+			const int32 Start = OutgoingStart[NodeIdx];
+			const int32 Count = OutgoingStart[NodeIdx + 1] - Start;
+			if (!Count) { return; }
 
-			if (TwinPosInList == INDEX_NONE)
+			TArrayView<int32> NodeOutgoing = MakeArrayView(Outgoing.GetData() + Start, Count);
+			if (Count > 1)
 			{
-				HE.NextIndex = -1;
-				continue;
+				NodeOutgoing.Sort([this](const int32 A, const int32 B)
+				{
+					return HalfEdges[A].Angle < HalfEdges[B].Angle;
+				});
 			}
 
-			const int32 NextPosInList = (TwinPosInList + 1) % TargetOutgoing.Num();
-			HE.NextIndex = TargetOutgoing[NextPosInList];
-		}
-
-		NumFaces = 0;
-		bRawFacesEnumerated = false;
-		CachedRawFaces.Reset();
+			// This gives us faces with interior on the LEFT (CCW traversal)
+			for (int32 i = 0; i < Count; ++i)
+			{
+				HalfEdges[HalfEdges[NodeOutgoing[i]].TwinIndex].NextIndex = NodeOutgoing[(i + 1) % Count];
+			}
+		}, NumNodes < 1024);
 	}
 
 	const TArray<FRawFace>& FPlanarFaceEnumerator::EnumerateRawFaces()
@@ -257,66 +220,157 @@ namespace PCGExClusters
 
 		bRawFacesEnumerated = true;
 
-		// Mark all half-edges as unvisited
-		TArray<bool> Visited;
-		Visited.SetNumZeroed(HalfEdges.Num());
-
+		const int32 NumHalfEdges = HalfEdges.Num();
 		NumFaces = 0;
 
-		// Enumerate faces by following "next" pointers
-		for (int32 StartHE = 0; StartHE < HalfEdges.Num(); ++StartHE)
+		// Next pointers built by LinkHalfEdges form a permutation: every trace is a closed cycle first reached from its lowest half-edge.
+		std::atomic<bool> bClosedCycles{true};
+
 		{
-			if (Visited[StartHE]) { continue; }
+			TArray<int32> NumPrevious;
+			NumPrevious.Init(0, NumHalfEdges);
 
-			FRawFace& RawFace = CachedRawFaces.Emplace_GetRef(NumFaces);
-			RawFace.Nodes.Reserve(64);
+			ParallelFor(NumHalfEdges, [&](const int32 HEIdx)
+			{
+				const int32 NextHE = HalfEdges[HEIdx].NextIndex;
+				if (NextHE < 0 || NextHE >= NumHalfEdges) { bClosedCycles.store(false, std::memory_order_relaxed); }
+				else { FPlatformAtomics::InterlockedIncrement(&NumPrevious[NextHE]); }
+			}, NumHalfEdges < 4096);
 
-			int32 CurrentHE = StartHE;
-			const int32 MaxSteps = HalfEdges.Num();
+			if (bClosedCycles) { for (const int32 Count : NumPrevious) { if (Count != 1) { bClosedCycles = false; break; } } }
+		}
 
-			for (int32 Step = 0; Step < MaxSteps; ++Step)
+		if (!bClosedCycles)
+		{
+			// Broken topology, trace serially so partial walks are resolved the same way as always
+			TArray<bool> Visited;
+			Visited.SetNumZeroed(HalfEdges.Num());
+
+			// Enumerate faces by following "next" pointers
+			for (int32 StartHE = 0; StartHE < HalfEdges.Num(); ++StartHE)
 			{
-				if (CurrentHE < 0 || CurrentHE >= HalfEdges.Num())
-				{
-					RawFace.Nodes.Reset();
-					break;
-				}
+				if (Visited[StartHE]) { continue; }
+
+				FRawFace& RawFace = CachedRawFaces.Emplace_GetRef(NumFaces);
+				RawFace.Nodes.Reserve(64);
+
+				int32 CurrentHE = StartHE;
+				const int32 MaxSteps = HalfEdges.Num();
 
-				if (Visited[CurrentHE])
+				for (int32 Step = 0; Step < MaxSteps; ++Step)
 				{
-					if (CurrentHE != StartHE)
+					if (CurrentHE < 0 || CurrentHE >= HalfEdges.Num())
 					{
 						RawFace.Nodes.Reset();
+						break;
+					}
+
+					if (Visited[CurrentHE])
+					{
+						if (CurrentHE != StartHE)
+						{
+							RawFace.Nodes.Reset();
+						}
+						break;
 					}
-					break;
-				}
 
-				Visited[CurrentHE] = true;
-				RawFace.Nodes.Add(HalfEdges[CurrentHE].OriginNode);
-				HalfEdges[CurrentHE].FaceIndex = NumFaces;
+					Visited[CurrentHE] = true;
+					RawFace.Nodes.Add(HalfEdges[CurrentHE].OriginNode);
+					HalfEdges[CurrentHE].FaceIndex = NumFaces;
 
-				CurrentHE = HalfEdges[CurrentHE].NextIndex;
+					CurrentHE = HalfEdges[CurrentHE].NextIndex;
+				}
+
+				if (RawFace.Nodes.Num() >= 3)
+				{
+					NumFaces++;
+				}
+				else
+				{
+					CachedRawFaces.Pop();
+				}
 			}
+		}
+		else
+		{
+			// Label each half-edge with the lowest half-edge of its cycle. Walks claim half-edges by atomic min
+			// and stop as soon as they run into a lower label, which will cover the rest of that cycle.
+			TArray<int32> CycleRoot;
+			CycleRoot.Init(MAX_int32, NumHalfEdges);
 
-			if (RawFace.Nodes.Num() >= 3)
+			ParallelFor(NumHalfEdges, [&](const int32 StartHE)
 			{
-				NumFaces++;
+				if (FPlatformAtomics::AtomicRead_Relaxed(&CycleRoot[StartHE]) < StartHE) { return; }
+
+				int32 CurrentHE = StartHE;
+				while (true)
+				{
+					int32 Label = FPlatformAtomics::AtomicRead_Relaxed(&CycleRoot[CurrentHE]);
+					while (Label > StartHE)
+					{
+						const int32 Previous = FPlatformAtomics::InterlockedCompareExchange(&CycleRoot[CurrentHE], StartHE, Label);
+						if (Previous == Label) { break; }
+						Label = Previous;
+					}
+
+					if (Label <= StartHE) { return; }
+					CurrentHE = HalfEdges[CurrentHE].NextIndex;
+				}
+			}, NumHalfEdges < 4096);
+
+			// Cycles in ascending root order is the order the serial walk would have found them in
+			TArray<int32> Roots;
+			TArray<int32> CycleIndex;
+			CycleIndex.SetNumUninitialized(NumHalfEdges);
+			for (int32 HEIdx = 0; HEIdx < NumHalfEdges; ++HEIdx)
+			{
+				if (CycleRoot[HEIdx] != HEIdx) { continue; }
+				CycleIndex[HEIdx] = Roots.Add(HEIdx);
 			}
-			else
+
+			const int32 NumCycles = Roots.Num();
+
+			TArray<TArray<int32>> CycleNodes;
+			CycleNodes.SetNum(NumCycles);
+
+			ParallelFor(NumCycles, [&](const int32 Cycle)
 			{
-				CachedRawFaces.Pop();
+				TArray<int32>& Nodes = CycleNodes[Cycle];
+				int32 CurrentHE = Roots[Cycle];
+				do
+				{
+					Nodes.Add(HalfEdges[CurrentHE].OriginNode);
+					CurrentHE = HalfEdges[CurrentHE].NextIndex;
+				}
+				while (CurrentHE != Roots[Cycle]);
+			}, NumCycles < 32);
+
+			// Degenerate cycles are dropped, their half-edges keep the index of the next valid face as they would serially
+			TArray<int32> CycleFaceIndex;
+			CycleFaceIndex.SetNumUninitialized(NumCycles);
+			for (int32 Cycle = 0; Cycle < NumCycles; ++Cycle)
+			{
+				CycleFaceIndex[Cycle] = NumFaces;
+				if (CycleNodes[Cycle].Num() < 3) { continue; }
+				CachedRawFaces.Emplace_GetRef(NumFaces++).Nodes = MoveTemp(CycleNodes[Cycle]);
 			}
+
+			ParallelFor(NumHalfEdges, [&](const int32 HEIdx)
+			{
+				HalfEdges[HEIdx].FaceIndex = CycleFaceIndex[CycleIndex[CycleRoot[HEIdx]]];
+			}, NumHalfEdges < 4096);
 		}
 
 		// Compute 3D bounds for each face (for early culling in bounded operations)
-		for (FRawFace& RawFace : CachedRawFaces)
+		ParallelFor(CachedRawFaces.Num(), [&](const int32 RawFaceIdx)
 		{
+			FRawFace& RawFace = CachedRawFaces[RawFaceIdx];
 			RawFace.Bounds3D = FBox(ForceInit);
 			for (const int32 NodeIdx : RawFace.Nodes)
 			{
 				RawFace.Bounds3D += Cluster->GetPos(NodeIdx);
 			}
-		}
+		}, CachedRawFaces.Num() < 32);
 
 		return CachedRawFaces;
 	}
@@ -795,52 +849,89 @@ namespace PCGExClusters
 		return ECellResult::Success;
 	}
 
-	int32 FPlanarFaceEnumerator::FindFaceContaining(const FVector2D& Point) const
+	const PCGExBVH::FBVH* FPlanarFaceEnumerator::GetOrBuildFaceIndex() const
 	{
 		// LocalTangent: 2D point query is meaningless (no global 2D space)
-		if (bIsLocalTangent) { return -1; }
+		if (bIsLocalTangent || !bRawFacesEnumerated || !ProjectedPositions) { return nullptr; }
 
-		// Simple point-in-polygon test for each face
-		// This could be optimized with spatial indexing
-		TArray<FVector2D> FacePolygon;
+		{
+			FRWScopeLock ReadLock(FaceIndexLock, SLT_ReadOnly);
+			if (FaceBVH) { return FaceBVH.Get(); }
+		}
 
-		for (int32 StartHE = 0; StartHE < HalfEdges.Num(); ++StartHE)
+		FRWScopeLock WriteLock(FaceIndexLock, SLT_Write);
+		if (FaceBVH) { return FaceBVH.Get(); }
+
+		TRACE_CPUPROFILER_EVENT_SCOPE(FPlanarFaceEnumerator::BuildFaceIndex);
+
+		const TArray<FVector2D>& Positions = *ProjectedPositions;
+		const int32 NumRawFaces = CachedRawFaces.Num();
+
+		FacePolygons.SetNum(NumRawFaces);
+
+		TArray<PCGExBVH::FItem> Items;
+		Items.SetNum(NumRawFaces);
+
+		ParallelFor(NumRawFaces, [&](const int32 RawFaceIdx)
 		{
-			const int32 FaceIdx = HalfEdges[StartHE].FaceIndex;
-			if (FaceIdx < 0) { continue; }
+			const FRawFace& RawFace = CachedRawFaces[RawFaceIdx];
+			TArray<FVector2D>& Polygon = FacePolygons[RawFaceIdx];
 
-			// Check if we've already tested this face
-			bool bAlreadyTested = false;
-			for (int32 PrevHE = 0; PrevHE < StartHE; ++PrevHE)
+			FBox Bounds(ForceInit);
+			Polygon.SetNumUninitialized(RawFace.Nodes.Num());
+			for (int32 i = 0; i < RawFace.Nodes.Num(); ++i)
 			{
-				if (HalfEdges[PrevHE].FaceIndex == FaceIdx)
-				{
-					bAlreadyTested = true;
-					break;
-				}
+				Polygon[i] = Positions[RawFace.Nodes[i]];
+				Bounds += FVector(Polygon[i], 0);
 			}
-			if (bAlreadyTested) { continue; }
 
-			// Build face polygon (ProjectedPositions is node-indexed)
-			FacePolygon.Reset();
-			int32 CurrentHE = StartHE;
-			const int32 MaxSteps = HalfEdges.Num();
+			Items[RawFaceIdx] = PCGExBVH::FItem(Bounds, RawFace.FaceIndex);
+		}, NumRawFaces < 256);
 
-			for (int32 Step = 0; Step < MaxSteps; ++Step)
-			{
-				const FHalfEdge& HE = HalfEdges[CurrentHE];
-				FacePolygon.Add((*ProjectedPositions)[HE.OriginNode]);
-				CurrentHE = HE.NextIndex;
-				if (CurrentHE == StartHE) { break; }
-			}
+		const TSharedPtr<PCGExBVH::FBVH> NewBVH = MakeShared<PCGExBVH::FBVH>();
+		NewBVH->Build(MoveTemp(Items));
 
-			if (FacePolygon.Num() >= 3 && PCGExMath::Geo::IsPointInPolygon(Point, FacePolygon))
+		FaceBVH = NewBVH;
+		return FaceBVH.Get();
+	}
+
+	int32 FPlanarFaceEnumerator::FindFaceContaining(const PCGExBVH::FBVH& InFaceBVH, const FVector2D& Point, const TBitArray<>* FaceMask) const
+	{
+		// Overlapping faces (e.g the wrapper) resolve to the lowest face index, i.e the first one traced
+		int32 Best = -1;
+
+		const FVector Query(Point, 0);
+		InFaceBVH.FindElementsWithBoundsTest(
+			FBox(Query, Query), [&](const int32 FaceIdx)
 			{
-				return FaceIdx;
-			}
-		}
+				if (Best != -1 && FaceIdx > Best) { return; }
+				if (FaceMask && (!FaceMask->IsValidIndex(FaceIdx) || !(*FaceMask)[FaceIdx])) { return; }
+				if (PCGExMath::Geo::IsPointInPolygon(Point, FacePolygons[FaceIdx])) { Best = FaceIdx; }
+			});
+
+		return Best;
+	}
 
-		return -1;
+	int32 FPlanarFaceEnumerator::FindFaceContaining(const FVector2D& Point) const
+	{
+		const PCGExBVH::FBVH* Index = GetOrBuildFaceIndex();
+		return Index ? FindFaceContaining(*Index, Point) : -1;
+	}
+
+	void FPlanarFaceEnumerator::FindFacesContaining(const TConstArrayView<FVector2D> Points, TArray<int32>& OutFaceIndices, const TBitArray<>* FaceMask) const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FPlanarFaceEnumerator::FindFacesContaining);
+
+		const int32 NumPoints = Points.Num();
+		OutFaceIndices.Init(-1, NumPoints);
+
+		const PCGExBVH::FBVH* Index = GetOrBuildFaceIndex();
+		if (!Index) { return; }
+
+		ParallelFor(NumPoints, [&](const int32 i)
+		{
+			OutFaceIndices[i] = FindFaceContaining(*Index, Points[i], FaceMask);
+		}, NumPoints < 256);
 	}
 
 	TMap<int32, TSet<int32>> FPlanarFaceEnumerator::BuildCellAdjacencyMap(int32 WrapperFaceIndex) const
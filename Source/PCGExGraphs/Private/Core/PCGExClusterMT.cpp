@@ -631,6 +631,13 @@ namespace PCGExClusterMT
 	{
 		if (!bIsBatchValid) { return; }
 
+		{
+			TArray<int32> Costs;
+			Costs.Reserve(Processors.Num());
+			for (const TSharedRef<IProcessor>& P : Processors) { Costs.Add(P->EdgeDataFacade->GetNum()); }
+			PCGExMT::CoalesceWorkUnits(Costs, PCGEX_CORE_SETTINGS.SmallClusterSize, ProcessorUnitOrder, ProcessorUnits);
+		}
+
 		PCGEX_ASYNC_MT_LOOP_TPL(
 			Process, bForceSingleThreadedProcessing, {Processor->bIsProcessorValid = Processor->Process(This->TaskManager); }, {
 			Process->OnCompleteCallback = [PCGEX_ASYNC_THIS_CAPTURE]() { PCGEX_ASYNC_THIS This->OnInitialPostProcess(); }; })
@@ -717,6 +724,8 @@ namespace PCGExClusterMT
 	{
 		for (const TSharedRef<IProcessor>& P : Processors) { P->Cleanup(); }
 		Processors.Empty();
+		ProcessorUnitOrder.Empty();
+		ProcessorUnits.Empty();
 	}
 
 	void IBatch::AllocateVtxPoints()
@@ -5,6 +5,7 @@
 
 #include "PCGExH.h"
 #include "Clusters/PCGExEdge.h"
+#include "Clusters/PCGExSpanningForest.h"
 #include "Core/PCGExMTCommon.h"
 #include "Graphs/PCGExSubGraph.h"
 
@@ -257,85 +258,135 @@ namespace PCGExGraphs
 		const int32 NumNodes = Nodes.Num();
 		const int32 NumEdges = Edges.Num();
 
-		TArray<bool> VisitedNodes;
-		VisitedNodes.Init(false, NumNodes);
-		TArray<bool> VisitedEdges;
-		VisitedEdges.Init(false, NumEdges);
+		// Roaming nodes can't be part of any subgraph
+		PCGEX_PARALLEL_FOR(
+			NumNodes,
+			FNode& Node = Nodes[i];
+			if (Node.IsEmpty()) { Node.bValid = false; }
+			else if (Node.bValid) { Node.NumExportedEdges = 0; }
+		)
+
+		// Connected components over live edges, united concurrently.
+		// Roots are the smallest node index of each component, so numbering components by ascending root
+		// yields the same subgraph order as a sequential traversal seeded in node order.
+		PCGExClusters::SpanningForest::FConcurrentUnionFind Components(NumNodes);
+
+		TArray<int8> LiveEdges;
+		LiveEdges.SetNumUninitialized(NumEdges);
 
-		int32 VisitedNodesNum = 0;
-		int32 VisitedEdgesNum = 0;
+		PCGEX_PARALLEL_FOR(
+			NumEdges,
+			const FEdge& Edge = Edges[i];
+			LiveEdges[i] = Edge.bValid && Nodes[Edge.Start].bValid && Nodes[Edge.End].bValid;
+			if (LiveEdges[i]) { Components.Unite(Edge.Start, Edge.End); }
+		)
 
-		TArray<int32> Stack;
-		Stack.Reserve(NumNodes);
-		OutValidNodes.Reserve(NumNodes);
+		TArray<int32> Labels;
+		Labels.SetNumUninitialized(NumNodes);
+		PCGEX_PARALLEL_FOR(NumNodes, Labels[i] = Nodes[i].bValid ? Components.Find(i) : -1;)
 
+		// Roots precede every other member of their component, so root labels are already resolved when members are reached
+		int32 NumComponents = 0;
+		TArray<int32> NodeCounts;
 		for (int32 i = 0; i < NumNodes; i++)
 		{
-			FNode& CurrentNode = Nodes[i];
-			if (VisitedNodes[i])
+			const int32 Root = Labels[i];
+			if (Root == -1) { continue; }
+
+			if (Root == i)
 			{
-				continue;
+				Labels[i] = NumComponents++;
+				NodeCounts.Add(1);
 			}
-
-			if (!CurrentNode.bValid || CurrentNode.IsEmpty())
+			else
 			{
-				CurrentNode.bValid = false;
-				continue;
+				Labels[i] = Labels[Root];
+				NodeCounts[Labels[i]]++;
 			}
+		}
+
+		TArray<int32> EdgeCounts;
+		EdgeCounts.Init(0, NumComponents);
+		for (int32 i = 0; i < NumEdges; i++) { if (LiveEdges[i]) { EdgeCounts[Labels[Edges[i].Start]]++; } }
+
+		// Single nodes without any live edge never make a subgraph, but are still subject to limits
+		if (!Limits.IsValid(1, 0))
+		{
+			PCGEX_PARALLEL_FOR(
+				NumNodes,
+				const int32 Label = Labels[i];
+				if (Label != -1 && !EdgeCounts[Label]) { Nodes[i].bValid = false; }
+			)
+		}
+
+		const TSharedRef<FGraph> ThisGraph = SharedThis(this);
+
+		TArray<TSharedPtr<FSubGraph>> Candidates;
+		Candidates.SetNum(NumComponents);
 
-			Stack.Reset();
-			Stack.Add(i);
-			VisitedNodes[i] = true;
-			VisitedNodesNum++;
+		PCGEX_PARALLEL_FOR(
+			NumComponents,
+			if (!EdgeCounts[i]) { return; }
+
+			const TSharedPtr<FSubGraph> SubGraph = MakeShared<FSubGraph>();
+			SubGraph->WeakParentGraph = ThisGraph;
+			SubGraph->Nodes.SetNumUninitialized(NodeCounts[i]);
+			SubGraph->Edges.SetNumUninitialized(EdgeCounts[i]);
+			Candidates[i] = SubGraph;
+		)
+
+		// Members are written in ascending index order, which keeps subgraph content independent of link order
+		{
+			TArray<int32> Cursors;
+			Cursors.Init(0, NumComponents);
 
-			TSharedPtr<FSubGraph> SubGraph = MakeShared<FSubGraph>();
-			SubGraph->WeakParentGraph = SharedThis(this);
-			SubGraph->Nodes.Reserve(NumNodes - VisitedNodesNum);
-			SubGraph->Edges.Reserve(NumEdges - VisitedEdgesNum);
+			for (int32 i = 0; i < NumNodes; i++)
+			{
+				const int32 Label = Labels[i];
+				if (Label == -1 || !Candidates[Label]) { continue; }
+				Candidates[Label]->Nodes[Cursors[Label]++] = i;
+			}
 
-			while (!Stack.IsEmpty())
+			FMemory::Memzero(Cursors.GetData(), NumComponents * sizeof(int32));
+
+			for (int32 i = 0; i < NumEdges; i++)
 			{
-				const int32 NodeIndex = Stack.Pop(EAllowShrinking::No);
-				SubGraph->Nodes.Add(NodeIndex);
-				FNode& Node = Nodes[NodeIndex];
-				Node.NumExportedEdges = 0;
-
-				for (const FLink& Lk : Node.Links)
-				{
-					const int32 E = Lk.Edge;
-					if (VisitedEdges[E]) { continue; }
-
-					VisitedEdges[E] = true;
-					VisitedEdgesNum++;
-
-					FEdge& Edge = Edges[E];
-					if (!Edge.bValid) { continue; }
-
-					const int32 OtherIndex = Edge.Other(NodeIndex);
-					if (!Nodes[OtherIndex].bValid) { continue; }
-
-					SubGraph->Add(Edge);
-
-					if (!VisitedNodes[OtherIndex])
-					{
-						VisitedNodes[OtherIndex] = true;
-						VisitedNodesNum++;
-						Stack.Add(OtherIndex);
-					}
-				}
+				if (!LiveEdges[i]) { continue; }
+				const FEdge& Edge = Edges[i];
+				const int32 Label = Labels[Edge.Start];
+				Candidates[Label]->Edges[Cursors[Label]++] = PCGEx::FIndexKey(Edge.Index, Edge.H64U());
 			}
+		}
+
+		PCGEX_PARALLEL_FOR(
+			NumComponents,
+			const TSharedPtr<FSubGraph>& SubGraph = Candidates[i];
+			if (!SubGraph) { return; }
 
 			if (!Limits.IsValid(SubGraph->Nodes.Num(), SubGraph->Edges.Num()))
 			{
 				for (const int32 j : SubGraph->Nodes) { Nodes[j].bValid = false; }
 				for (const PCGEx::FIndexKey j : SubGraph->Edges) { Edges[j.Index].bValid = false; }
+				Candidates[i] = nullptr;
+				return;
 			}
-			else if (!SubGraph->Edges.IsEmpty())
+
+			for (const PCGEx::FIndexKey j : SubGraph->Edges)
 			{
-				OutValidNodes.Append(SubGraph->Nodes);
-				SubGraph->Shrink();
-				SubGraphs.Add(SubGraph.ToSharedRef());
+				const int32 IOIndex = Edges[j.Index].IOIndex;
+				if (IOIndex >= 0) { SubGraph->EdgesInIOIndices.Add(IOIndex); }
 			}
+		)
+
+		int32 NumValidNodes = OutValidNodes.Num();
+		for (const TSharedPtr<FSubGraph>& SubGraph : Candidates) { if (SubGraph) { NumValidNodes += SubGraph->Nodes.Num(); } }
+		OutValidNodes.Reserve(NumValidNodes);
+
+		for (const TSharedPtr<FSubGraph>& SubGraph : Candidates)
+		{
+			if (!SubGraph) { continue; }
+			OutValidNodes.Append(SubGraph->Nodes);
+			SubGraphs.Add(SubGraph.ToSharedRef());
 		}
 
 		// Recompute NumExportedEdges deterministically based on actual edge connections.
@@ -14,6 +14,11 @@ namespace PCGExMath
 	struct FBestFitPlane;
 }
 
+namespace PCGExBVH
+{
+	class FBVH;
+}
+
 namespace PCGExClusters
 {
 	class FCluster;
@@ -92,6 +97,11 @@ namespace PCGExClusters
 		mutable int32 CachedAdjacencyWrapperIndex = INDEX_NONE;
 		mutable bool bAdjacencyMapCached = false;
 
+		// Point-location index over CachedRawFaces (lazy-computed, thread-safe)
+		mutable FRWLock FaceIndexLock;
+		mutable TSharedPtr<PCGExBVH::FBVH> FaceBVH;
+		mutable TArray<TArray<FVector2D>> FacePolygons;
+
 	public:
 		FPlanarFaceEnumerator() = default;
 
@@ -166,11 +176,22 @@ namespace PCGExClusters
 
 		/**
 		 * Find the face containing a given 2D point.
+		 * Requires EnumerateRawFaces() to have been called first. The first query builds a face bounds BVH
+		 * that lives as long as the enumerator (and its cluster cache entry, if any).
 		 * @param Point The 2D point to test
-		 * @return Face index, or -1 if not found
+		 * @return Lowest index of the faces containing the point, or -1 if not found
 		 */
 		int32 FindFaceContaining(const FVector2D& Point) const;
 
+		/**
+		 * Batched FindFaceContaining, queries run in parallel.
+		 * Requires EnumerateRawFaces() to have been called first; every point resolves to -1 otherwise.
+		 * @param Points The 2D points to test
+		 * @param OutFaceIndices Output face index per point, -1 if not found
+		 * @param FaceMask Optional face-indexed mask, faces whose bit isn't set are ignored (e.g to skip the wrapper)
+		 */
+		void FindFacesContaining(TConstArrayView<FVector2D> Points, TArray<int32>& OutFaceIndices, const TBitArray<>* FaceMask = nullptr) const;
+
 		/**
 		 * Get the outer (wrapper) face index.
 		 * This is the unbounded face surrounding the entire graph.
@@ -237,6 +258,18 @@ namespace PCGExClusters
 		void GetFaceHalfEdges(int32 FaceIndex, TArray<int32>& OutHalfEdgeIndices) const;
 
 	protected:
+		/** Build HalfEdgeMap, sort each node's outgoing half-edges by angle and link "next" pointers. Expects twins to be set. */
+		void LinkHalfEdges(const int32 NumNodes);
+
+		/**
+		 * Get or build the face point-location index.
+		 * Precondition: EnumerateRawFaces() has run, the index is built from the cached raw faces.
+		 * @return nullptr if faces aren't enumerated yet or there is no global 2D space (LocalTangent)
+		 */
+		const PCGExBVH::FBVH* GetOrBuildFaceIndex() const;
+
+		int32 FindFaceContaining(const PCGExBVH::FBVH& InFaceBVH, const FVector2D& Point, const TBitArray<>* FaceMask = nullptr) const;
+
 		/** Build a cell from a face (list of node indices) - internal use */
 		ECellResult BuildCellFromFace(
 			const TArray<int32>& FaceNodes,
@@ -248,6 +248,10 @@ namespace PCGExClusterMT
 		TArray<TSharedRef<IProcessor>> Processors;
 		int32 GetNumProcessors() const { return Processors.Num(); }
 
+		// Processors grouped by edge count, see PCGExMT::CoalesceWorkUnits
+		TArray<int32> ProcessorUnitOrder;
+		TArray<PCGExMT::FScope> ProcessorUnits;
+
 		bool bIsBatchValid = true;
 		FPCGExContext* ExecutionContext = nullptr;
 		UPCGSettings* ExecutionSettings = nullptr;
@@ -58,6 +58,110 @@ namespace PCGExMatching
 		MatchMode = Details->Mode;
 	}
 
+	void FDataMatcher::BuildIndices()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FDataMatcher::BuildIndices);
+
+		RequiredIndices.Reset();
+		OptionalIndices.Reset();
+		bOptionalFullyIndexed = false;
+
+		// Not worth it for a handful of sources
+		if (NumSources < 16) { return; }
+
+		TArray<uint64> Keys;
+		auto BuildIndex = [&](const TSharedPtr<FPCGExMatchRuleOperation>& Op, TArray<FRuleIndex>& OutIndices)
+		{
+			if (!Op->IsIndexable()) { return false; }
+
+			FRuleIndex& Index = OutIndices.Emplace_GetRef();
+			Index.Operation = Op.Get();
+
+			for (int32 i = 0; i < NumSources; i++)
+			{
+				Keys.Reset();
+				Op->GetSourceKeys(*(MatchableSourceFirstElements->GetData() + i), Keys);
+
+				for (const uint64 Key : Keys)
+				{
+					TArray<int32>& Sources = Index.Sources.FindOrAdd(Key);
+					if (Sources.IsEmpty() || Sources.Last() != i) { Sources.Add(i); }
+				}
+			}
+
+			return true;
+		};
+
+		for (const TSharedPtr<FPCGExMatchRuleOperation>& Op : RequiredOperations) { BuildIndex(Op, RequiredIndices); }
+
+		int32 NumIndexedOptional = 0;
+		for (const TSharedPtr<FPCGExMatchRuleOperation>& Op : OptionalOperations) { if (BuildIndex(Op, OptionalIndices)) { NumIndexedOptional++; } }
+		bOptionalFullyIndexed = !OptionalOperations.IsEmpty() && NumIndexedOptional == OptionalOperations.Num();
+	}
+
+	bool FDataMatcher::GetIndexedSources(const FPCGExTaggedData& InDataCandidate, TBitArray<>& OutSources) const
+	{
+		if (MatchMode == EPCGExMapMatchMode::Disabled) { return false; }
+
+		// In "All" mode optional rules must pass as well; in "Any" mode they only narrow things down if none of them needs a full scan
+		const bool bOptionalRequired = MatchMode == EPCGExMapMatchMode::All;
+		if (RequiredIndices.IsEmpty() && (bOptionalRequired ? OptionalIndices.IsEmpty() : !bOptionalFullyIndexed)) { return false; }
+
+		TArray<uint64> Keys;
+		TBitArray<> RuleSources;
+
+		auto Gather = [&](const FRuleIndex& Index)
+		{
+			Keys.Reset();
+			Index.Operation->GetCandidateKeys(InDataCandidate, Keys);
+
+			for (const uint64 Key : Keys)
+			{
+				if (const TArray<int32>* Sources = Index.Sources.Find(Key)) { for (const int32 i : *Sources) { RuleSources[i] = true; } }
+			}
+		};
+
+		OutSources.Init(true, NumSources);
+
+		for (const FRuleIndex& Index : RequiredIndices)
+		{
+			RuleSources.Init(false, NumSources);
+			Gather(Index);
+			OutSources.CombineWithBitwiseAND(RuleSources, EBitwiseOperatorFlags::MaintainSize);
+		}
+
+		if (bOptionalRequired)
+		{
+			for (const FRuleIndex& Index : OptionalIndices)
+			{
+				RuleSources.Init(false, NumSources);
+				Gather(Index);
+				OutSources.CombineWithBitwiseAND(RuleSources, EBitwiseOperatorFlags::MaintainSize);
+			}
+		}
+		else if (bOptionalFullyIndexed)
+		{
+			RuleSources.Init(false, NumSources);
+			for (const FRuleIndex& Index : OptionalIndices) { Gather(Index); }
+			OutSources.CombineWithBitwiseAND(RuleSources, EBitwiseOperatorFlags::MaintainSize);
+		}
+
+		return true;
+	}
+
+	template <typename FFunc>
+	void FDataMatcher::ForEachIndexedSource(const FPCGExTaggedData& InDataCandidate, FFunc&& Func) const
+	{
+		TBitArray<> Sources;
+		if (!GetIndexedSources(InDataCandidate, Sources))
+		{
+			for (int32 i = 0; i < NumSources; i++) { Func(i); }
+			return;
+		}
+
+		for (TConstSetBitIterator<> It(Sources); It; ++It) { Func(It.GetIndex()); }
+	}
+
 
 #define PCGEX_MATCH_SOURCE_LABEL InSourceLabel.IsNone() ? Labels::SourceMatchRulesLabel : InSourceLabel
 
@@ -286,13 +390,17 @@ namespace PCGExMatching
 
 		int32 NumIgnored = 0;
 		TArray<FPCGExTaggedData>& MatchableSourcesRef = *MatchableSources.Get();
-		for (const FPCGExTaggedData& Source : MatchableSourcesRef)
+
+		// Sources left out by the indices can't match, they are ignored without being tested
+		TBitArray<> Matched(false, NumSources);
+		ForEachIndexedSource(InDataCandidate, [&](const int32 i) { Matched[i] = Test(MatchableSourcesRef[i].Data, InDataCandidate, InMatchingScope); });
+
+		for (int32 i = 0; i < NumSources; i++)
 		{
-			if (!Test(Source.Data, InDataCandidate, InMatchingScope))
-			{
-				OutIgnoreList.Add(Source.Data);
-				NumIgnored++;
-			}
+			if (Matched[i]) { continue; }
+
+			OutIgnoreList.Add(MatchableSourcesRef[i].Data);
+			NumIgnored++;
 		}
 
 		return MatchableSources->Num() != NumIgnored;
@@ -356,11 +464,12 @@ namespace PCGExMatching
 				return OutMatches.Num();
 			}
 
-			for (int32 i = 0; i < NumSources; i++)
-			{
-				if (InExcludedSources->Contains(i)) { continue; }
-				if (Test(MatchableSourcesRef[i].Data, InDataCandidate, InMatchingScope)) { OutMatches.Add(i); }
-			}
+			ForEachIndexedSource(
+				InDataCandidate, [&](const int32 i)
+				{
+					if (InExcludedSources->Contains(i)) { return; }
+					if (Test(MatchableSourcesRef[i].Data, InDataCandidate, InMatchingScope)) { OutMatches.Add(i); }
+				});
 
 			// Handle recursive/transitive matching
 			if (bWantsRecursion && !OutMatches.IsEmpty())
@@ -378,16 +487,17 @@ namespace PCGExMatching
 
 					for (const int32 CurrentIdx : CurrentLevel)
 					{
-						for (int32 i = 0; i < NumSources; i++)
-						{
-							if (Visited[i] || InExcludedSources->Contains(i)) { continue; }
-							if (Test(MatchableSourcesRef[i].Data, MatchableSourcesRef[CurrentIdx], InMatchingScope))
+						ForEachIndexedSource(
+							MatchableSourcesRef[CurrentIdx], [&](const int32 i)
 							{
-								Visited[i] = true;
-								OutMatches.Add(i);
-								NextLevel.Add(i);
-							}
-						}
+								if (Visited[i] || InExcludedSources->Contains(i)) { return; }
+								if (Test(MatchableSourcesRef[i].Data, MatchableSourcesRef[CurrentIdx], InMatchingScope))
+								{
+									Visited[i] = true;
+									OutMatches.Add(i);
+									NextLevel.Add(i);
+								}
+							});
 					}
 
 					CurrentLevel = MoveTemp(NextLevel);
@@ -404,10 +514,11 @@ namespace PCGExMatching
 			return OutMatches.Num();
 		}
 
-		for (int32 i = 0; i < NumSources; i++)
-		{
-			if (Test(MatchableSourcesRef[i].Data, InDataCandidate, InMatchingScope)) { OutMatches.Add(i); }
-		}
+		ForEachIndexedSource(
+			InDataCandidate, [&](const int32 i)
+			{
+				if (Test(MatchableSourcesRef[i].Data, InDataCandidate, InMatchingScope)) { OutMatches.Add(i); }
+			});
 
 		// Handle recursive/transitive matching
 		if (bWantsRecursion && !OutMatches.IsEmpty())
@@ -425,16 +536,17 @@ namespace PCGExMatching
 
 				for (const int32 CurrentIdx : CurrentLevel)
 				{
-					for (int32 i = 0; i < NumSources; i++)
-					{
-						if (Visited[i]) { continue; }
-						if (Test(MatchableSourcesRef[i].Data, MatchableSourcesRef[CurrentIdx], InMatchingScope))
+					ForEachIndexedSource(
+						MatchableSourcesRef[CurrentIdx], [&](const int32 i)
 						{
-							Visited[i] = true;
-							OutMatches.Add(i);
-							NextLevel.Add(i);
-						}
-					}
+							if (Visited[i]) { return; }
+							if (Test(MatchableSourcesRef[i].Data, MatchableSourcesRef[CurrentIdx], InMatchingScope))
+							{
+								Visited[i] = true;
+								OutMatches.Add(i);
+								NextLevel.Add(i);
+							}
+						});
 				}
 
 				CurrentLevel = MoveTemp(NextLevel);
@@ -555,6 +667,8 @@ namespace PCGExMatching
 			}
 		}
 
+		BuildIndices();
+
 		return true;
 	}
 }
@@ -93,6 +93,79 @@ bool FPCGExMatchAttrToAttr::Test(const PCGExData::FConstPoint& InTargetElement,
 	return Config.bInvert ? !bResult : bResult;
 }
 
+bool FPCGExMatchAttrToAttr::IsIndexable() const
+{
+	if (Config.bInvert) { return false; }
+
+	if (Config.Check == EPCGExComparisonDataType::Numeric)
+	{
+		return Config.NumericComparison == EPCGExComparison::StrictlyEqual || Config.NumericComparison == EPCGExComparison::NearlyEqual;
+	}
+
+	return Config.StringComparison == EPCGExStringComparison::StrictlyEqual;
+}
+
+namespace PCGExMatchAttrToAttr
+{
+	// Values past this many buckets away from zero share a single key
+	constexpr double MaxBucket = 1e15;
+	constexpr uint64 OverflowKey = MAX_uint64;
+
+	// Nearly-equal values always land in the same or in adjacent buckets when buckets are at least as wide as the tolerance
+	static void GetNumericKeys(const double InValue, const EPCGExComparison InComparison, const double InTolerance, const bool bNeighbors, TArray<uint64>& OutKeys)
+	{
+		if (InComparison == EPCGExComparison::StrictlyEqual)
+		{
+			const double Value = InValue + 0.0;
+			uint64 Bits;
+			FMemory::Memcpy(&Bits, &Value, sizeof(uint64));
+			OutKeys.Add(Bits);
+			return;
+		}
+
+		const double Bucket = InValue / FMath::Max(InTolerance, UE_DOUBLE_SMALL_NUMBER);
+		if (!FMath::IsFinite(Bucket) || FMath::Abs(Bucket) > MaxBucket - 2)
+		{
+			OutKeys.Add(OverflowKey);
+			if (!FMath::IsFinite(Bucket) || FMath::Abs(Bucket) > MaxBucket) { return; }
+		}
+
+		const int64 Key = FMath::FloorToInt64(Bucket);
+		OutKeys.Add(static_cast<uint64>(Key));
+		if (bNeighbors)
+		{
+			OutKeys.Add(static_cast<uint64>(Key - 1));
+			OutKeys.Add(static_cast<uint64>(Key + 1));
+		}
+	}
+}
+
+void FPCGExMatchAttrToAttr::GetSourceKeys(const PCGExData::FConstPoint& InMatchableSourceElement, TArray<uint64>& OutKeys) const
+{
+	if (Config.Check == EPCGExComparisonDataType::Numeric)
+	{
+		PCGExMatchAttrToAttr::GetNumericKeys(NumGetters[InMatchableSourceElement.IO]->FetchSingle(InMatchableSourceElement, MAX_dbl), Config.NumericComparison, Config.Tolerance, false, OutKeys);
+		return;
+	}
+
+	OutKeys.Add(NameKey(StrGetters[InMatchableSourceElement.IO]->FetchSingle(InMatchableSourceElement, TEXT(""))));
+}
+
+void FPCGExMatchAttrToAttr::GetCandidateKeys(const FPCGExTaggedData& InCandidate, TArray<uint64>& OutKeys) const
+{
+	if (Config.Check == EPCGExComparisonDataType::Numeric)
+	{
+		double CandidateValue = 0;
+		if (!PCGExData::Helpers::TryReadDataValue<double>(Context, InCandidate.Data, Config.CandidateAttributeName_Sanitized, CandidateValue)) { return; }
+		PCGExMatchAttrToAttr::GetNumericKeys(CandidateValue, Config.NumericComparison, Config.Tolerance, true, OutKeys);
+		return;
+	}
+
+	FString CandidateValue = TEXT("");
+	if (!PCGExData::Helpers::TryReadDataValue<FString>(Context, InCandidate.Data, Config.CandidateAttributeName_Sanitized, CandidateValue)) { return; }
+	OutKeys.Add(NameKey(CandidateValue));
+}
+
 bool UPCGExMatchAttrToAttrFactory::WantsPoints()
 {
 	return !PCGExMetaHelpers::IsDataDomainAttribute(Config.TargetAttributeName);
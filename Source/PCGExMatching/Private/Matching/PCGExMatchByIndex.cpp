@@ -73,6 +73,39 @@ bool FPCGExMatchByIndex::Test(const PCGExData::FConstPoint& InTargetElement, con
 	return Config.bInvert ? !bResult : bResult;
 }
 
+bool FPCGExMatchByIndex::IsIndexable() const
+{
+	if (Config.bInvert) { return false; }
+
+	// Target-side indices are sanitized against the number of candidates, which is only known at test time;
+	// only "Ignore" keeps a one-to-one mapping between the raw index and the one that gets compared.
+	return Config.Source == EPCGExMatchByIndexSource::Candidate || Config.IndexSafety == EPCGExIndexSafety::Ignore;
+}
+
+void FPCGExMatchByIndex::GetSourceKeys(const PCGExData::FConstPoint& InMatchableSourceElement, TArray<uint64>& OutKeys) const
+{
+	int32 Key = InMatchableSourceElement.Data ? InMatchableSourceElement.Index : InMatchableSourceElement.IO;
+	if (Config.Source == EPCGExMatchByIndexSource::Target && !bIsIndex) { Key = IndexGetters[InMatchableSourceElement.IO]->FetchSingle(InMatchableSourceElement, -1); }
+
+	if (Key != -1) { OutKeys.Add(static_cast<uint64>(Key)); }
+}
+
+void FPCGExMatchByIndex::GetCandidateKeys(const FPCGExTaggedData& InCandidate, TArray<uint64>& OutKeys) const
+{
+	if (Config.Source == EPCGExMatchByIndexSource::Target)
+	{
+		OutKeys.Add(static_cast<uint64>(InCandidate.Index));
+		return;
+	}
+
+	// Data-level sources have no point data, so indices are sanitized against the number of sources
+	int32 IndexValue = -1;
+	if (!PCGExData::Helpers::TryReadDataValue<int32>(Context, InCandidate.Data, Config.IndexAttribute, IndexValue)) { return; }
+
+	IndexValue = PCGExMath::SanitizeIndex(IndexValue, MatchableSources->Num() - 1, Config.IndexSafety);
+	if (IndexValue != -1) { OutKeys.Add(static_cast<uint64>(IndexValue)); }
+}
+
 bool UPCGExMatchByIndexFactory::WantsPoints()
 {
 	return !PCGExMetaHelpers::IsDataDomainAttribute(Config.IndexAttribute);
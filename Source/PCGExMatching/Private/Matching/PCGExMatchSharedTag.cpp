@@ -75,17 +75,21 @@ bool FPCGExMatchSharedTag::Test(const PCGExData::FConstPoint& InTargetElement, c
 			// If the raw string in the tag:value format, enforce value check
 			if (TSharedPtr<PCGExData::IDataValue> Value = PCGExData::TryGetValueFromTag(TestTagName, TestTagName)) { bDoValueMatch = true; }
 
-			TSharedPtr<PCGExData::IDataValue> TargetValue = TargetTags->GetValue(TestTagName);
-			TSharedPtr<PCGExData::IDataValue> SourceValue = CandidateTags->GetValue(TestTagName);
+			// A name that was never interned can't be on either side
+			const PCGExData::FTagId TestTag = PCGExData::FTagTable::Find(TestTagName);
+			if (!TestTag.IsValid()) { break; }
+
+			const PCGExData::FTagValue* TargetValue = TargetTags->FindValue_Unsafe(TestTag);
+			const PCGExData::FTagValue* SourceValue = CandidateTags->FindValue_Unsafe(TestTag);
 
 			if (bDoValueMatch)
 			{
 				if (!TargetValue || !SourceValue) { bResult = false; }
-				else { bResult = TargetValue->SameValue(SourceValue); }
+				else { bResult = TargetValue->SameValue(*SourceValue); }
 			}
 			else if (TargetValue && SourceValue) { bResult = true; }
 			else if (TargetValue || SourceValue) { bResult = false; }
-			else { bResult = TargetTags->RawTags.Contains(TestTagName) && CandidateTags->RawTags.Contains(TestTagName); }
+			else { bResult = TargetTags->HasRawTag_Unsafe(TestTag) && CandidateTags->HasRawTag_Unsafe(TestTag); }
 		}
 		break;
 
@@ -95,11 +99,11 @@ bool FPCGExMatchSharedTag::Test(const PCGExData::FConstPoint& InTargetElement, c
 			if (Config.bMatchTagValues)
 			{
 				// Check value tags
-				for (const TPair<FString, TSharedPtr<PCGExData::IDataValue>>& Pair : TargetTags->ValueTags)
+				for (const PCGExData::FValueTag& ValueTag : TargetTags->GetValueTags_Unsafe())
 				{
-					if (TSharedPtr<PCGExData::IDataValue> CandidateValue = CandidateTags->GetValue(Pair.Key))
+					if (const PCGExData::FTagValue* CandidateValue = CandidateTags->FindValue_Unsafe(ValueTag.Key))
 					{
-						if (Pair.Value->SameValue(CandidateValue))
+						if (ValueTag.Value.SameValue(*CandidateValue))
 						{
 							bResult = true;
 							break;
@@ -110,9 +114,9 @@ bool FPCGExMatchSharedTag::Test(const PCGExData::FConstPoint& InTargetElement, c
 			else
 			{
 				// Check raw tags
-				for (const FString& Tag : TargetTags->RawTags)
+				for (const PCGExData::FTagId& Tag : TargetTags->GetRawTags_Unsafe())
 				{
-					if (CandidateTags->RawTags.Contains(Tag))
+					if (CandidateTags->HasRawTag_Unsafe(Tag))
 					{
 						bResult = true;
 						break;
@@ -122,9 +126,9 @@ bool FPCGExMatchSharedTag::Test(const PCGExData::FConstPoint& InTargetElement, c
 				// Check value tag names (ignoring values)
 				if (!bResult)
 				{
-					for (const TPair<FString, TSharedPtr<PCGExData::IDataValue>>& Pair : TargetTags->ValueTags)
+					for (const PCGExData::FValueTag& ValueTag : TargetTags->GetValueTags_Unsafe())
 					{
-						if (CandidateTags->ValueTags.Contains(Pair.Key))
+						if (CandidateTags->FindValue_Unsafe(ValueTag.Key))
 						{
 							bResult = true;
 							break;
@@ -143,10 +147,10 @@ bool FPCGExMatchSharedTag::Test(const PCGExData::FConstPoint& InTargetElement, c
 			if (Config.bMatchTagValues)
 			{
 				// All candidate value tags must exist with same value in target
-				for (const TPair<FString, TSharedPtr<PCGExData::IDataValue>>& Pair : CandidateTags->ValueTags)
+				for (const PCGExData::FValueTag& ValueTag : CandidateTags->GetValueTags_Unsafe())
 				{
-					TSharedPtr<PCGExData::IDataValue> TargetValue = TargetTags->GetValue(Pair.Key);
-					if (!TargetValue || !Pair.Value->SameValue(TargetValue))
+					const PCGExData::FTagValue* TargetValue = TargetTags->FindValue_Unsafe(ValueTag.Key);
+					if (!TargetValue || !ValueTag.Value.SameValue(*TargetValue))
 					{
 						bResult = false;
 						break;
@@ -156,9 +160,9 @@ bool FPCGExMatchSharedTag::Test(const PCGExData::FConstPoint& InTargetElement, c
 				// All candidate raw tags must exist in target
 				if (bResult)
 				{
-					for (const FString& Tag : CandidateTags->RawTags)
+					for (const PCGExData::FTagId& Tag : CandidateTags->GetRawTags_Unsafe())
 					{
-						if (!TargetTags->RawTags.Contains(Tag))
+						if (!TargetTags->HasRawTag_Unsafe(Tag))
 						{
 							bResult = false;
 							break;
@@ -169,9 +173,9 @@ bool FPCGExMatchSharedTag::Test(const PCGExData::FConstPoint& InTargetElement, c
 			else
 			{
 				// All candidate raw tags must exist in target
-				for (const FString& Tag : CandidateTags->RawTags)
+				for (const PCGExData::FTagId& Tag : CandidateTags->GetRawTags_Unsafe())
 				{
-					if (!TargetTags->RawTags.Contains(Tag))
+					if (!TargetTags->HasRawTag_Unsafe(Tag))
 					{
 						bResult = false;
 						break;
@@ -181,9 +185,9 @@ bool FPCGExMatchSharedTag::Test(const PCGExData::FConstPoint& InTargetElement, c
 				// All candidate value tag names must exist in target (ignoring values)
 				if (bResult)
 				{
-					for (const TPair<FString, TSharedPtr<PCGExData::IDataValue>>& Pair : CandidateTags->ValueTags)
+					for (const PCGExData::FValueTag& ValueTag : CandidateTags->GetValueTags_Unsafe())
 					{
-						if (!TargetTags->ValueTags.Contains(Pair.Key))
+						if (!TargetTags->FindValue_Unsafe(ValueTag.Key))
 						{
 							bResult = false;
 							break;
@@ -193,7 +197,7 @@ bool FPCGExMatchSharedTag::Test(const PCGExData::FConstPoint& InTargetElement, c
 			}
 
 			// Empty candidate tags always match
-			if (CandidateTags->RawTags.IsEmpty() && CandidateTags->ValueTags.IsEmpty()) { bResult = true; }
+			if (CandidateTags->IsEmpty()) { bResult = true; }
 		}
 		break;
 	}
@@ -201,6 +205,47 @@ bool FPCGExMatchSharedTag::Test(const PCGExData::FConstPoint& InTargetElement, c
 	return Config.bInvert ? !bResult : bResult;
 }
 
+bool FPCGExMatchSharedTag::IsIndexable() const
+{
+	// "All shared" is a subset test, it can't be answered by a key lookup
+	return !Config.bInvert && Config.Mode != EPCGExTagMatchMode::AllShared;
+}
+
+void FPCGExMatchSharedTag::GetTagKeys(const TSharedPtr<PCGExData::FTags>& InTags, TArray<uint64>& OutKeys) const
+{
+	if (Config.Mode == EPCGExTagMatchMode::Specific || !Config.bMatchTagValues)
+	{
+		// Specific mode only needs both sides to have the tag, whatever its form
+		const uint32 RawKind = Config.Mode == EPCGExTagMatchMode::Specific ? 0 : 1;
+		for (const PCGExData::FTagId& Tag : InTags->GetRawTags_Unsafe()) { OutKeys.Add(NameKey(PCGExData::FTagTable::ToString(Tag), RawKind)); }
+	}
+
+	for (const PCGExData::FValueTag& ValueTag : InTags->GetValueTags_Unsafe()) { OutKeys.Add(NameKey(PCGExData::FTagTable::ToString(ValueTag.Key))); }
+}
+
+void FPCGExMatchSharedTag::GetSourceKeys(const PCGExData::FConstPoint& InMatchableSourceElement, TArray<uint64>& OutKeys) const
+{
+	TSharedPtr<PCGExData::FTags> TargetTags = Tags[InMatchableSourceElement.IO].Pin();
+	if (!TargetTags) { return; }
+
+	if (Config.Mode != EPCGExTagMatchMode::Specific)
+	{
+		GetTagKeys(TargetTags, OutKeys);
+		return;
+	}
+
+	// Resolve the tag name the same way Test does
+	FString TestTagName = TagNameGetters.IsEmpty() ? Config.TagName : TagNameGetters[InMatchableSourceElement.IO]->FetchSingle(InMatchableSourceElement, TEXT(""));
+	PCGExData::TryGetValueFromTag(TestTagName, TestTagName);
+
+	if (TargetTags->IsTagged(TestTagName)) { OutKeys.Add(NameKey(TestTagName)); }
+}
+
+void FPCGExMatchSharedTag::GetCandidateKeys(const FPCGExTaggedData& InCandidate, TArray<uint64>& OutKeys) const
+{
+	if (TSharedPtr<PCGExData::FTags> CandidateTags = InCandidate.GetTags()) { GetTagKeys(CandidateTags, OutKeys); }
+}
+
 bool UPCGExMatchSharedTagFactory::WantsPoints()
 {
 	return Config.Mode == EPCGExTagMatchMode::Specific &&
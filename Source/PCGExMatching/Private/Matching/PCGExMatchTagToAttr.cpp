@@ -4,6 +4,7 @@
 #include "Matching/PCGExMatchTagToAttr.h"
 
 #include "Data/PCGExAttributeBroadcaster.h"
+#include "Data/PCGExDataTags.h"
 #include "Data/PCGExPointIO.h"
 #include "Factories/PCGExFactoryData.h"
 
@@ -113,6 +114,25 @@ bool FPCGExMatchTagToAttr::Test(const PCGExData::FConstPoint& InTargetElement, c
 	return !Config.bInvert;
 }
 
+bool FPCGExMatchTagToAttr::IsIndexable() const
+{
+	return !Config.bInvert && Config.NameMatch == EPCGExStringMatchMode::Equals;
+}
+
+void FPCGExMatchTagToAttr::GetSourceKeys(const PCGExData::FConstPoint& InMatchableSourceElement, TArray<uint64>& OutKeys) const
+{
+	OutKeys.Add(NameKey(TagNameGetters.IsEmpty() ? Config.TagName : TagNameGetters[InMatchableSourceElement.IO]->FetchSingle(InMatchableSourceElement, TEXT(""))));
+}
+
+void FPCGExMatchTagToAttr::GetCandidateKeys(const FPCGExTaggedData& InCandidate, TArray<uint64>& OutKeys) const
+{
+	const TSharedPtr<PCGExData::FTags> CandidateTags = InCandidate.GetTags();
+	if (!CandidateTags) { return; }
+
+	for (const PCGExData::FTagId& Tag : CandidateTags->GetRawTags_Unsafe()) { OutKeys.Add(NameKey(PCGExData::FTagTable::ToString(Tag))); }
+	for (const PCGExData::FValueTag& ValueTag : CandidateTags->GetValueTags_Unsafe()) { OutKeys.Add(NameKey(PCGExData::FTagTable::ToString(ValueTag.Key))); }
+}
+
 bool UPCGExMatchTagToAttrFactory::WantsPoints()
 {
 	if (Config.TagNameInput == EPCGExInputValueType::Attribute && !PCGExMetaHelpers::IsDataDomainAttribute(Config.TagNameAttribute)) { return true; }
@@ -77,7 +77,27 @@ public:
 	/** Maximum recursion depth (-1 = unlimited). Only meaningful if WantsRecursion() returns true. */
 	virtual int32 GetMaxRecursionDepth() const { return -1; }
 
+	/**
+	 * Whether this rule can be turned into an inverted index for data-level matching.
+	 * An indexable rule can only pass when the source and the candidate share at least one key.
+	 * Keys are hashes and may collide : they narrow down which sources get tested, Test still has the final word.
+	 */
+	virtual bool IsIndexable() const { return false; }
+
+	/** Append the index keys of a matchable source, read from the same element data-level tests use. */
+	virtual void GetSourceKeys(const PCGExData::FConstPoint& InMatchableSourceElement, TArray<uint64>& OutKeys) const
+	{
+	}
+
+	/** Append the index keys of a candidate. */
+	virtual void GetCandidateKeys(const FPCGExTaggedData& InCandidate, TArray<uint64>& OutKeys) const
+	{
+	}
+
 protected:
+	/** Case-insensitive name key, consistent with FString equality. Kind is used to keep separate key spaces apart. */
+	FORCEINLINE static uint64 NameKey(const FString& InName, const uint32 InKind = 0) { return (static_cast<uint64>(InKind) << 32) | GetTypeHash(InName); }
+
 	TSharedPtr<TArray<FPCGExTaggedData>> MatchableSources;
 };
 
@@ -60,6 +60,17 @@ namespace PCGExMatching
 		TArray<TSharedPtr<FPCGExMatchRuleOperation>> RequiredOperations;
 		TArray<TSharedPtr<FPCGExMatchRuleOperation>> OptionalOperations;
 
+		/** Inverted index of an indexable rule : key -> sources having that key, in ascending order */
+		struct FRuleIndex
+		{
+			const FPCGExMatchRuleOperation* Operation = nullptr;
+			TMap<uint64, TArray<int32>> Sources;
+		};
+
+		TArray<FRuleIndex> RequiredIndices;
+		TArray<FRuleIndex> OptionalIndices;
+		bool bOptionalFullyIndexed = false;
+
 	public:
 		EPCGExMapMatchMode MatchMode = EPCGExMapMatchMode::Disabled;
 
@@ -107,6 +118,19 @@ namespace PCGExMatching
 
 	protected:
 		int32 GetMatchLimitFor(const FPCGExTaggedData& InDataCandidate) const;
+
+		void BuildIndices();
+
+		/**
+		 * Narrow down the sources a candidate could match at data level, using the rule indices.
+		 * Returns false if no index applies, in which case every source must be tested.
+		 */
+		bool GetIndexedSources(const FPCGExTaggedData& InDataCandidate, TBitArray<>& OutSources) const;
+
+		/** Invoke Func(SourceIndex) for every source worth a data-level Test against the candidate, in ascending order */
+		template <typename FFunc>
+		void ForEachIndexedSource(const FPCGExTaggedData& InDataCandidate, FFunc&& Func) const;
+
 		void RegisterTaggedData(FPCGExContext* InContext, const FPCGExTaggedData& InTaggedData);
 		bool InitInternal(FPCGExContext* InContext, const FName InFactoriesLabel);
 		bool InitInternal(const TArray<TObjectPtr<const UPCGExMatchRuleFactoryData>>& InFactories);
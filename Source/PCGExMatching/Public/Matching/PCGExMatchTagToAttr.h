@@ -81,6 +81,10 @@ public:
 
 	virtual bool Test(const PCGExData::FConstPoint& InTargetElement, const FPCGExTaggedData& InCandidate, const PCGExMatching::FScope& InMatchingScope) const override;
 
+	virtual bool IsIndexable() const override;
+	virtual void GetSourceKeys(const PCGExData::FConstPoint& InMatchableSourceElement, TArray<uint64>& OutKeys) const override;
+	virtual void GetCandidateKeys(const FPCGExTaggedData& InCandidate, TArray<uint64>& OutKeys) const override;
+
 protected:
 	TArray<TSharedPtr<PCGExData::TAttributeBroadcaster<FString>>> TagNameGetters;
 	TArray<TSharedPtr<PCGExData::TAttributeBroadcaster<double>>> NumGetters;
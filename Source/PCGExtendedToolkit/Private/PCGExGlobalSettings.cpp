@@ -42,6 +42,7 @@ void UPCGExGlobalSettings::UpdateSettingsCaches() const
 	PCGEX_PUSH_SETTING(Core, bDefaultScopedAttributeGet)
 	PCGEX_PUSH_SETTING(Core, bBulkInitData)
 	PCGEX_PUSH_SETTING(Core, bUseDelaunator)
+	PCGEX_PUSH_SETTING(Core, bDelaunayHilbertSort)
 	PCGEX_PUSH_SETTING(Core, bAssertOnEmptyThread)
 	PCGEX_PUSH_SETTING(Core, ExecutionPolicy)
 
@@ -54,6 +55,7 @@ void UPCGExGlobalSettings::UpdateSettingsCaches() const
 
 	PCGEX_PUSH_SETTING(Core, SmallPointsSize)
 	PCGEX_PUSH_SETTING(Core, SmallClusterSize)
+	PCGEX_PUSH_SETTING(Core, AttributeColumnCacheBudgetMB)
 	PCGEX_PUSH_SETTING(Core, PointsDefaultBatchChunkSize)
 	PCGEX_PUSH_SETTING(Core, ClusterDefaultBatchChunkSize)
 
@@ -52,6 +52,10 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster")
 	bool bUseDelaunator = true;
 
+	/** Insert Delaunay positions along a Hilbert curve for better locality. Delaunator already orders its input, so this only affects 3D and non-Delaunator 2D. Degenerate inputs (e.g grids) may triangulate differently. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster")
+	bool bDelaunayHilbertSort = false;
+
 	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster", meta=(ClampMin=1))
 	int32 SmallClusterSize = 512;
 
@@ -74,6 +78,10 @@ public:
 	int32 SmallPointsSize = 1024;
 	bool IsSmallPointSize(const int32 InNum) const { return InNum <= SmallPointsSize; }
 
+	/** Memory budget for decoded input attributes shared across nodes reading the same data. 0 disables the cache. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Points", meta=(ClampMin=0))
+	int32 AttributeColumnCacheBudgetMB = 256;
+
 	UPROPERTY(EditAnywhere, config, Category = "Performance|Points", meta=(ClampMin=1))
 	int32 PointsDefaultBatchChunkSize = 1024;
 	int32 GetPointsBatchChunkSize(const int32 In = -1) const { return In <= -1 ? PointsDefaultBatchChunkSize : In; }
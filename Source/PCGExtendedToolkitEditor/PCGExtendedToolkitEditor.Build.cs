@@ -81,7 +81,13 @@ public class PCGExtendedToolkitEditor : ModuleRules
 				"LevelEditor",
 				"SceneOutliner", 
 				"AdvancedPreviewScene",
-				"PCGEditor"
+				"PCGEditor",
+				"Json",
+
+				// Benchmark
+				"PCGExBlending",
+				"PCGExGraphs",
+				"PCGExNoise3D"
 			}
 		);
 		
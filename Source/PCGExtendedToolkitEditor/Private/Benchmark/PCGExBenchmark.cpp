@@ -0,0 +1,505 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Benchmark/PCGExBenchmark.h"
+
+#include "PCGExCoreSettingsCache.h"
+#include "PCGExH.h"
+#include "Clusters/PCGExCluster.h"
+#include "Clusters/PCGExClusterCommon.h"
+#include "Containers/PCGExIndexLookup.h"
+#include "Core/PCGExContext.h"
+#include "Core/PCGExMT.h"
+#include "Data/PCGExData.h"
+#include "Data/PCGExPointIO.h"
+#include "Data/PCGPointArrayData.h"
+#include "Details/PCGExFuseDetails.h"
+#include "Graphs/Union/PCGExIntersections.h"
+#include "Helpers/PCGExPointArrayDataHelpers.h"
+#include "Math/Geo/PCGExDelaunay.h"
+#include "Noises/PCGExNoisePerlin.h"
+#include "Noises/PCGExNoiseSimplex.h"
+#include "Noises/PCGExNoiseWorley.h"
+#include "Sorting/PCGExPointSorter.h"
+#include "Sorting/PCGExSortingDetails.h"
+#include "Utils/PCGExScoredQueue.h"
+
+namespace PCGExBenchmark
+{
+	namespace
+	{
+		constexpr int32 Seed = 42;
+		constexpr double Spacing = 100;
+		constexpr int32 PathLength = 64;
+	}
+
+	namespace Inputs
+	{
+		void PointCloud(const int32 NumPoints, const int32 InSeed, TArray<FVector>& OutPositions)
+		{
+			const FRandomStream Random(InSeed);
+			const double Extent = Spacing * FMath::Max(1.0, FMath::Pow(static_cast<double>(NumPoints), 1.0 / 3.0));
+
+			OutPositions.SetNumUninitialized(NumPoints);
+			for (FVector& Position : OutPositions)
+			{
+				Position = FVector(Random.FRandRange(-Extent, Extent), Random.FRandRange(-Extent, Extent), Random.FRandRange(-Extent, Extent));
+			}
+		}
+
+		void Grid(const int32 NumPoints, TArray<FVector>& OutPositions, TArray<uint64>& OutEdges)
+		{
+			const int32 Side = FMath::Max(2, FMath::CeilToInt32(FMath::Sqrt(static_cast<double>(NumPoints))));
+
+			OutPositions.SetNumUninitialized(Side * Side);
+			OutEdges.Reset(2 * Side * (Side - 1));
+
+			for (int32 Y = 0; Y < Side; Y++)
+			{
+				for (int32 X = 0; X < Side; X++)
+				{
+					const int32 Index = Y * Side + X;
+					OutPositions[Index] = FVector(X * Spacing, Y * Spacing, 0);
+
+					if (X > 0) { OutEdges.Add(PCGEx::H64U(Index - 1, Index)); }
+					if (Y > 0) { OutEdges.Add(PCGEx::H64U(Index - Side, Index)); }
+				}
+			}
+		}
+
+		bool Delaunay(const int32 NumPoints, const int32 InSeed, TArray<FVector>& OutPositions, TArray<uint64>& OutEdges)
+		{
+			PointCloud(NumPoints, InSeed, OutPositions);
+
+			PCGExMath::Geo::TDelaunay3 Delaunay;
+			if (!Delaunay.Process(MakeArrayView(OutPositions))) { return false; }
+
+			OutEdges = MoveTemp(Delaunay.DelaunayEdges);
+			return true;
+		}
+
+		void Paths(const int32 NumPoints, const int32 InSeed, TArray<TArray<FVector>>& OutPaths)
+		{
+			const FRandomStream Random(InSeed);
+
+			// Lattice small enough that walks keep crossing each other, so fusing has work to do
+			const int32 Side = FMath::Max(2, FMath::CeilToInt32(FMath::Sqrt(static_cast<double>(NumPoints))));
+			const int32 NumPaths = FMath::Max(1, FMath::DivideAndRoundUp(NumPoints, PathLength));
+
+			static const FIntPoint Steps[] = {FIntPoint(1, 0), FIntPoint(-1, 0), FIntPoint(0, 1), FIntPoint(0, -1)};
+
+			OutPaths.SetNum(NumPaths);
+			for (TArray<FVector>& Path : OutPaths)
+			{
+				FIntPoint Cell(Random.RandRange(0, Side - 1), Random.RandRange(0, Side - 1));
+
+				Path.SetNumUninitialized(PathLength);
+				for (FVector& Position : Path)
+				{
+					Position = FVector(Cell.X * Spacing, Cell.Y * Spacing, 0);
+
+					const FIntPoint& Step = Steps[Random.RandRange(0, 3)];
+					Cell.X = FMath::Clamp(Cell.X + Step.X, 0, Side - 1);
+					Cell.Y = FMath::Clamp(Cell.Y + Step.Y, 0, Side - 1);
+				}
+			}
+		}
+	}
+
+	FEnvironment::FEnvironment()
+	{
+		Context = MakeUnique<FPCGExContext>();
+	}
+
+	FEnvironment::~FEnvironment()
+	{
+		KeepAlive.Empty();
+		Context.Reset();
+	}
+
+	UPCGBasePointData* FEnvironment::NewPointData(const TArrayView<const FVector> Positions)
+	{
+		UPCGPointArrayData* Data = NewObject<UPCGPointArrayData>();
+		KeepAlive.Emplace(Data);
+
+		PCGExPointArrayDataHelpers::SetNumPointsAllocated(Data, Positions.Num(), EPCGPointNativeProperties::Transform | EPCGPointNativeProperties::MetadataEntry);
+
+		TPCGValueRange<FTransform> Transforms = Data->GetTransformValueRange(false);
+		TPCGValueRange<int64> MetadataEntries = Data->GetMetadataEntryValueRange(false);
+
+		for (int32 i = 0; i < Positions.Num(); i++)
+		{
+			Transforms[i].SetLocation(Positions[i]);
+			MetadataEntries[i] = Data->Metadata->AddEntry();
+		}
+
+		return Data;
+	}
+
+	UPCGBasePointData* FEnvironment::NewEdgeData(const TArrayView<const FVector> Positions, const TArrayView<const uint64> Edges)
+	{
+		TArray<FVector> Midpoints;
+		Midpoints.SetNumUninitialized(Edges.Num());
+
+		for (int32 i = 0; i < Edges.Num(); i++)
+		{
+			uint32 A;
+			uint32 B;
+			PCGEx::H64(Edges[i], A, B);
+			Midpoints[i] = FMath::Lerp(Positions[A], Positions[B], 0.5);
+		}
+
+		UPCGBasePointData* Data = NewPointData(Midpoints);
+
+		// Vtx hashes are plain point indices; the cluster lookup maps them back 1:1
+		FPCGMetadataAttribute<int64>* EndpointsAttribute = Data->Metadata->CreateAttribute<int64>(PCGExClusters::Labels::Attr_PCGExEdgeIdx, 0, false, false);
+		const TConstPCGValueRange<int64> MetadataEntries = Data->GetConstMetadataEntryValueRange();
+
+		for (int32 i = 0; i < Edges.Num(); i++) { EndpointsAttribute->SetValue(MetadataEntries[i], static_cast<int64>(Edges[i])); }
+
+		return Data;
+	}
+
+	void FEnvironment::RunAndWait(TFunctionRef<void(const TSharedPtr<PCGExMT::FTaskManager>&)> Schedule) const
+	{
+		FEvent* Done = FPlatformProcess::GetSynchEventFromPool(true);
+
+		// Not the context's own manager : that one reports back to a PCG element we don't have
+		const TSharedPtr<PCGExMT::FTaskManager> TaskManager = MakeShared<PCGExMT::FTaskManager>(Context.Get());
+		TaskManager->OnEndCallback = [Done](const bool bWasCancelled) { Done->Trigger(); };
+
+		Schedule(TaskManager);
+
+		// A manager only leaves Idle once work has been scheduled on it
+		if (TaskManager->GetState() != PCGExMT::EAsyncHandleState::Idle) { Done->Wait(); }
+
+		FPlatformProcess::ReturnSynchEventToPool(Done);
+		Context->UnpauseContext();
+	}
+
+#pragma region Cases
+
+	namespace
+	{
+		FRun MakeSubLoops(FEnvironment& Env, const int32 Scale)
+		{
+			TSharedRef<TArray<FVector>> Positions = MakeShared<TArray<FVector>>();
+			Inputs::PointCloud(Scale, Seed, *Positions);
+
+			TSharedRef<TArray<uint64>> Hashes = MakeShared<TArray<uint64>>();
+			Hashes->SetNumZeroed(Scale);
+
+			FRun Run;
+			Run.Execute = [&Env, Positions, Hashes]()
+			{
+				Env.RunAndWait(
+					[&](const TSharedPtr<PCGExMT::FTaskManager>& TaskManager)
+					{
+						PCGEX_ASYNC_GROUP_CHKD_VOID(TaskManager, HashPositions)
+
+						HashPositions->OnSubLoopStartCallback = [Positions, Hashes](const PCGExMT::FScope& Scope)
+						{
+							PCGEX_SCOPE_LOOP(Index) { (*Hashes)[Index] = PCGEx::SH3((*Positions)[Index], FVector(10)); }
+						};
+
+						HashPositions->StartSubLoops(Positions->Num(), PCGEX_CORE_SETTINGS.GetPointsBatchChunkSize());
+					});
+			};
+
+			return Run;
+		}
+
+		FRun MakeDelaunay(FEnvironment& Env, const int32 Scale)
+		{
+			TSharedRef<TArray<FVector>> Positions = MakeShared<TArray<FVector>>();
+			Inputs::PointCloud(Scale, Seed, *Positions);
+
+			FRun Run;
+			Run.Execute = [Positions]()
+			{
+				PCGExMath::Geo::TDelaunay3 Delaunay;
+				Delaunay.Process(MakeArrayView(*Positions));
+			};
+
+			return Run;
+		}
+
+		FRun MakeBuildFrom(FEnvironment& Env, const TArray<FVector>& Positions, const TArray<uint64>& Edges)
+		{
+			const TWeakPtr<FPCGContextHandle> Handle = Env.GetContext()->GetOrCreateHandle();
+
+			TSharedPtr<PCGExData::FPointIO> VtxIO = MakeShared<PCGExData::FPointIO>(Handle, Env.NewPointData(Positions));
+			TSharedPtr<PCGExData::FPointIO> EdgesIO = MakeShared<PCGExData::FPointIO>(Handle, Env.NewEdgeData(Positions, Edges));
+
+			TSharedRef<TMap<uint32, int32>> EndpointsLookup = MakeShared<TMap<uint32, int32>>();
+			EndpointsLookup->Reserve(Positions.Num());
+			for (int32 i = 0; i < Positions.Num(); i++) { EndpointsLookup->Add(i, i); }
+
+			FRun Run;
+			Run.Execute = [VtxIO, EdgesIO, EndpointsLookup]()
+			{
+				const TSharedPtr<PCGEx::FIndexLookup> NodeIndexLookup = MakeShared<PCGEx::FIndexLookup>(VtxIO->GetNum());
+				const TSharedPtr<PCGExClusters::FCluster> Cluster = MakeShared<PCGExClusters::FCluster>(VtxIO, EdgesIO, NodeIndexLookup);
+				Cluster->BuildFrom(*EndpointsLookup, nullptr);
+			};
+
+			return Run;
+		}
+
+		FRun MakeBuildFromGrid(FEnvironment& Env, const int32 Scale)
+		{
+			TArray<FVector> Positions;
+			TArray<uint64> Edges;
+			Inputs::Grid(Scale, Positions, Edges);
+			return MakeBuildFrom(Env, Positions, Edges);
+		}
+
+		FRun MakeBuildFromDelaunay(FEnvironment& Env, const int32 Scale)
+		{
+			TArray<FVector> Positions;
+			TArray<uint64> Edges;
+			if (!Inputs::Delaunay(Scale, Seed, Positions, Edges)) { return FRun(); }
+			return MakeBuildFrom(Env, Positions, Edges);
+		}
+
+		FRun MakeUnionGraph(FEnvironment& Env, const int32 Scale)
+		{
+			TArray<TArray<FVector>> Paths;
+			Inputs::Paths(Scale, Seed, Paths);
+
+			TSharedRef<TArray<const UPCGBasePointData*>> PathData = MakeShared<TArray<const UPCGBasePointData*>>();
+			FBox Bounds(ForceInit);
+			int32 NumPoints = 0;
+
+			for (const TArray<FVector>& Path : Paths)
+			{
+				PathData->Add(Env.NewPointData(Path));
+				Bounds += FBox(Path);
+				NumPoints += Path.Num();
+			}
+
+			Bounds = Bounds.ExpandBy(10);
+
+			FRun Run;
+			Run.Execute = [&Env, PathData, Bounds, NumPoints]()
+			{
+				const FPCGExFuseDetails FuseDetails(false, 10);
+				const TSharedPtr<PCGExGraphs::FUnionGraph> UnionGraph = MakeShared<PCGExGraphs::FUnionGraph>(FuseDetails, Bounds);
+
+				if (!UnionGraph->Init(Env.GetContext())) { return; }
+				UnionGraph->Reserve(NumPoints, -1);
+				UnionGraph->EdgesUnion->bIsAbstract = true;
+
+				{
+					PCGExGraphs::FUnionGraph::FBatchInserter Inserter(*UnionGraph);
+					for (int32 IO = 0; IO < PathData->Num(); IO++)
+					{
+						const UPCGBasePointData* Data = (*PathData)[IO];
+						for (int32 i = 1; i < Data->GetNumPoints(); i++)
+						{
+							Inserter.InsertEdge(PCGExData::FConstPoint(Data, i - 1, IO), PCGExData::FConstPoint(Data, i, IO));
+						}
+					}
+				}
+
+				UnionGraph->Collapse();
+			};
+
+			return Run;
+		}
+
+		FRun MakeDijkstra(FEnvironment& Env, const int32 Scale)
+		{
+			struct FGraph
+			{
+				TArray<FVector> Positions;
+				TArray<int32> Offsets;
+				TArray<int32> Neighbors;
+				TUniquePtr<PCGEx::FScoredQueue> Queue;
+			};
+
+			TArray<uint64> Edges;
+			TSharedRef<FGraph> Graph = MakeShared<FGraph>();
+			if (!Inputs::Delaunay(Scale, Seed, Graph->Positions, Edges)) { return FRun(); }
+
+			// Flat adjacency, built once outside the timed section
+			const int32 NumNodes = Graph->Positions.Num();
+			TArray<int32> Degrees;
+			Degrees.Init(0, NumNodes);
+
+			for (const uint64 Edge : Edges)
+			{
+				uint32 A;
+				uint32 B;
+				PCGEx::H64(Edge, A, B);
+				Degrees[A]++;
+				Degrees[B]++;
+			}
+
+			Graph->Offsets.SetNumUninitialized(NumNodes + 1);
+			Graph->Offsets[0] = 0;
+			for (int32 i = 0; i < NumNodes; i++) { Graph->Offsets[i + 1] = Graph->Offsets[i] + Degrees[i]; }
+
+			Graph->Neighbors.SetNumUninitialized(Graph->Offsets[NumNodes]);
+			for (int32 i = 0; i < NumNodes; i++) { Degrees[i] = Graph->Offsets[i]; }
+
+			for (const uint64 Edge : Edges)
+			{
+				uint32 A;
+				uint32 B;
+				PCGEx::H64(Edge, A, B);
+				Graph->Neighbors[Degrees[A]++] = B;
+				Graph->Neighbors[Degrees[B]++] = A;
+			}
+
+			Graph->Queue = MakeUnique<PCGEx::FScoredQueue>(NumNodes);
+
+			FRun Run;
+			Run.Reset = [Graph]() { Graph->Queue->Reset(); };
+			Run.Execute = [Graph]()
+			{
+				PCGEx::FScoredQueue& Queue = *Graph->Queue;
+				Queue.Enqueue(0, 0);
+
+				int32 Current = -1;
+				double Score = 0;
+
+				while (Queue.Dequeue(Current, Score))
+				{
+					const FVector& From = Graph->Positions[Current];
+					for (int32 i = Graph->Offsets[Current]; i < Graph->Offsets[Current + 1]; i++)
+					{
+						const int32 Neighbor = Graph->Neighbors[i];
+						Queue.Enqueue(Neighbor, Score + FVector::Dist(From, Graph->Positions[Neighbor]));
+					}
+				}
+			};
+
+			return Run;
+		}
+
+		template <typename T>
+		FRun MakeNoise(FEnvironment& Env, const int32 Scale, const int32 Octaves)
+		{
+			TSharedRef<TArray<FVector>> Positions = MakeShared<TArray<FVector>>();
+			Inputs::PointCloud(Scale, Seed, *Positions);
+
+			TSharedRef<TArray<double>> Values = MakeShared<TArray<double>>();
+			Values->SetNumUninitialized(Scale);
+
+			TSharedRef<T> Noise = MakeShared<T>();
+			Noise->Seed = Seed;
+			Noise->Frequency = 0.01;
+			Noise->Octaves = Octaves;
+
+			FRun Run;
+			Run.Execute = [Positions, Values, Noise]() { Noise->Generate(TArrayView<const FVector>(*Positions), MakeArrayView(*Values)); };
+
+			return Run;
+		}
+
+		FRun MakeSortCache(FEnvironment& Env, const int32 Scale)
+		{
+			TArray<FVector> Positions;
+			Inputs::PointCloud(Scale, Seed, Positions);
+
+			UPCGBasePointData* Data = Env.NewPointData(Positions);
+
+			// Coarse first rule with lots of ties, so the second rule actually gets compared
+			const FRandomStream Random(Seed);
+			FPCGMetadataAttribute<int32>* Bucket = Data->Metadata->CreateAttribute<int32>(FName("Bucket"), 0, false, false);
+			FPCGMetadataAttribute<double>* Value = Data->Metadata->CreateAttribute<double>(FName("Value"), 0, false, false);
+
+			const TConstPCGValueRange<int64> MetadataEntries = Data->GetConstMetadataEntryValueRange();
+			for (int32 i = 0; i < Scale; i++)
+			{
+				Bucket->SetValue(MetadataEntries[i], Random.RandRange(0, 15));
+				Value->SetValue(MetadataEntries[i], Random.FRand());
+			}
+
+			const TSharedPtr<PCGExData::FPointIO> PointIO = MakeShared<PCGExData::FPointIO>(Env.GetContext()->GetOrCreateHandle(), Data);
+			const TSharedRef<PCGExData::FFacade> Facade = MakeShared<PCGExData::FFacade>(PointIO.ToSharedRef());
+
+			TArray<FPCGExSortRuleConfig> Rules;
+			Rules.Emplace_GetRef().Selector.Update(TEXT("Bucket"));
+			Rules.Emplace_GetRef().Selector.Update(TEXT("Value"));
+
+			TSharedRef<PCGExSorting::FSorter> Sorter = MakeShared<PCGExSorting::FSorter>(Env.GetContext(), Facade, Rules);
+			if (!Sorter->Init(Env.GetContext())) { return FRun(); }
+
+			TSharedRef<TArray<int32>> Order = MakeShared<TArray<int32>>();
+			Order->SetNumUninitialized(Scale);
+
+			FRun Run;
+			Run.Reset = [Order]() { for (int32 i = 0; i < Order->Num(); i++) { (*Order)[i] = i; } };
+			Run.Execute = [Sorter, Order]()
+			{
+				const TSharedPtr<PCGExSorting::FSortCache> Cache = Sorter->BuildCache(Order->Num());
+				Cache->Sort(*Order);
+			};
+
+			return Run;
+		}
+	}
+
+	const TArray<FCase>& GetCases()
+	{
+		static const TArray<FCase> Cases = {
+			{TEXT("MT.SubLoops"), &MakeSubLoops},
+			{TEXT("Geo.Delaunay3"), &MakeDelaunay},
+			{TEXT("Cluster.BuildFrom.Grid"), &MakeBuildFromGrid},
+			{TEXT("Cluster.BuildFrom.Delaunay"), &MakeBuildFromDelaunay},
+			{TEXT("UnionGraph.Fuse"), &MakeUnionGraph},
+			{TEXT("ScoredQueue.Dijkstra"), &MakeDijkstra},
+			{TEXT("Noise.Perlin"), [](FEnvironment& Env, const int32 Scale) { return MakeNoise<FPCGExNoisePerlin>(Env, Scale, 4); }},
+			{TEXT("Noise.Simplex"), [](FEnvironment& Env, const int32 Scale) { return MakeNoise<FPCGExNoiseSimplex>(Env, Scale, 1); }},
+			{TEXT("Noise.Worley"), [](FEnvironment& Env, const int32 Scale) { return MakeNoise<FPCGExNoiseWorley>(Env, Scale, 1); }},
+			{TEXT("Sort.SortCache"), &MakeSortCache},
+		};
+
+		return Cases;
+	}
+
+#pragma endregion
+
+	FResult Run(FEnvironment& Environment, const FCase& Case, const int32 Scale, const int32 Iterations)
+	{
+		FResult Result;
+		Result.Name = Case.Name;
+		Result.Scale = Scale;
+
+		const FRun Work = Case.Setup(Environment, Scale);
+		if (!Work.Execute) { return Result; }
+
+		auto RunOnce = [&]()
+		{
+			if (Work.Reset) { Work.Reset(); }
+
+			const double Start = FPlatformTime::Seconds();
+			Work.Execute();
+			return (FPlatformTime::Seconds() - Start) * 1000;
+		};
+
+		RunOnce(); // Warm-up : first touch of caches, allocators and lazily initialized tables
+
+		TArray<double> Timings;
+		Timings.Reserve(Iterations);
+		for (int32 i = 0; i < Iterations; i++) { Timings.Add(RunOnce()); }
+
+		if (Timings.IsEmpty()) { return Result; }
+
+		Timings.Sort();
+
+		double Total = 0;
+		for (const double Timing : Timings) { Total += Timing; }
+
+		const int32 Mid = Timings.Num() / 2;
+
+		Result.Iterations = Timings.Num();
+		Result.MinMs = Timings[0];
+		Result.MedianMs = Timings.Num() % 2 ? Timings[Mid] : (Timings[Mid - 1] + Timings[Mid]) * 0.5;
+		Result.MeanMs = Total / Timings.Num();
+
+		return Result;
+	}
+}
@@ -0,0 +1,210 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Benchmark/PCGExBenchmarkCommandlet.h"
+
+#include "PCGExLog.h"
+#include "Benchmark/PCGExBenchmark.h"
+#include "Dom/JsonObject.h"
+#include "HAL/PlatformMisc.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace PCGExBenchmark
+{
+	namespace
+	{
+		bool LoadBaseline(const FString& Path, TMap<FString, double>& OutMedians)
+		{
+			FString Json;
+			if (!FFileHelper::LoadFileToString(Json, *Path)) { return false; }
+
+			TSharedPtr<FJsonObject> Root;
+			if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json), Root) || !Root.IsValid()) { return false; }
+
+			const TArray<TSharedPtr<FJsonValue>>* Results = nullptr;
+			if (!Root->TryGetArrayField(TEXT("Results"), Results)) { return false; }
+
+			for (const TSharedPtr<FJsonValue>& Value : *Results)
+			{
+				const TSharedPtr<FJsonObject>* Entry = nullptr;
+				if (!Value->TryGetObject(Entry)) { continue; }
+
+				FString Name;
+				int32 Scale = 0;
+				double MedianMs = 0;
+
+				if (!(*Entry)->TryGetStringField(TEXT("Name"), Name) ||
+					!(*Entry)->TryGetNumberField(TEXT("Scale"), Scale) ||
+					!(*Entry)->TryGetNumberField(TEXT("MedianMs"), MedianMs))
+				{
+					continue;
+				}
+
+				OutMedians.Add(FString::Printf(TEXT("%s@%d"), *Name, Scale), MedianMs);
+			}
+
+			return true;
+		}
+	}
+}
+
+UPCGExBenchmarkCommandlet::UPCGExBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UPCGExBenchmarkCommandlet::Main(const FString& Params)
+{
+	FString ScalesStr = TEXT("1000,10000,100000");
+	int32 Iterations = 5;
+	FString Filter;
+	FString OutputPath = FPaths::ProjectSavedDir() / TEXT("PCGEx") / TEXT("Benchmark.json");
+	FString BaselinePath;
+	double Tolerance = 0.1;
+
+	FParse::Value(*Params, TEXT("Scales="), ScalesStr);
+	FParse::Value(*Params, TEXT("Iterations="), Iterations);
+	FParse::Value(*Params, TEXT("Filter="), Filter);
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+	FParse::Value(*Params, TEXT("Baseline="), BaselinePath);
+	FParse::Value(*Params, TEXT("Tolerance="), Tolerance);
+
+	Iterations = FMath::Max(1, Iterations);
+
+	TArray<int32> Scales;
+	{
+		TArray<FString> ScaleStrs;
+		ScalesStr.ParseIntoArray(ScaleStrs, TEXT(","));
+		for (const FString& Str : ScaleStrs)
+		{
+			const int32 Scale = FCString::Atoi(*Str);
+			if (Scale > 0) { Scales.Add(Scale); }
+		}
+	}
+
+	if (Scales.IsEmpty())
+	{
+		UE_LOG(LogPCGEx, Error, TEXT("PCGExBenchmark : no valid scale in '%s'."), *ScalesStr);
+		return 1;
+	}
+
+	TMap<FString, double> Baseline;
+	bool bHasBaseline = false;
+
+	if (!BaselinePath.IsEmpty())
+	{
+		if (!PCGExBenchmark::LoadBaseline(BaselinePath, Baseline))
+		{
+			UE_LOG(LogPCGEx, Error, TEXT("PCGExBenchmark : could not read baseline '%s'."), *BaselinePath);
+			return 1;
+		}
+
+		bHasBaseline = true;
+	}
+
+	PCGExBenchmark::FEnvironment Environment;
+
+	TArray<TSharedPtr<FJsonValue>> JsonResults;
+	int32 NumRegressed = 0;
+
+	UE_LOG(LogPCGEx, Display, TEXT("%-32s %10s %12s %12s %12s %10s"), TEXT("Case"), TEXT("Scale"), TEXT("Median ms"), TEXT("Min ms"), TEXT("Baseline ms"), TEXT("Delta"));
+
+	for (const PCGExBenchmark::FCase& Case : PCGExBenchmark::GetCases())
+	{
+		if (!Filter.IsEmpty() && !Case.Name.Contains(Filter)) { continue; }
+
+		for (const int32 Scale : Scales)
+		{
+			const PCGExBenchmark::FResult Result = PCGExBenchmark::Run(Environment, Case, Scale, Iterations);
+
+			if (!Result.Iterations)
+			{
+				UE_LOG(LogPCGEx, Warning, TEXT("%-32s %10d  skipped, could not build inputs."), *Result.Name, Result.Scale);
+				continue;
+			}
+
+			const TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+			Entry->SetStringField(TEXT("Name"), Result.Name);
+			Entry->SetNumberField(TEXT("Scale"), Result.Scale);
+			Entry->SetNumberField(TEXT("Iterations"), Result.Iterations);
+			Entry->SetNumberField(TEXT("MinMs"), Result.MinMs);
+			Entry->SetNumberField(TEXT("MedianMs"), Result.MedianMs);
+			Entry->SetNumberField(TEXT("MeanMs"), Result.MeanMs);
+			Entry->SetNumberField(TEXT("ItemsPerSecond"), Result.GetItemsPerSecond());
+
+			FString Status = TEXT("New");
+			double BaselineMs = 0;
+			double Delta = 0;
+
+			if (const double* BaselinePtr = Baseline.Find(Result.GetKey()); BaselinePtr && *BaselinePtr > 0)
+			{
+				BaselineMs = *BaselinePtr;
+				Delta = (Result.MedianMs - BaselineMs) / BaselineMs;
+
+				if (Delta > Tolerance)
+				{
+					Status = TEXT("Regressed");
+					NumRegressed++;
+				}
+				else if (Delta < -Tolerance) { Status = TEXT("Improved"); }
+				else { Status = TEXT("Stable"); }
+
+				Entry->SetNumberField(TEXT("BaselineMs"), BaselineMs);
+				Entry->SetNumberField(TEXT("Delta"), Delta);
+			}
+
+			if (bHasBaseline) { Entry->SetStringField(TEXT("Status"), Status); }
+
+			JsonResults.Add(MakeShared<FJsonValueObject>(Entry));
+
+			UE_LOG(
+				LogPCGEx, Display,
+				TEXT("%-32s %10d %12.3f %12.3f %12s %10s %s"),
+				*Result.Name, Result.Scale, Result.MedianMs, Result.MinMs,
+				BaselineMs > 0 ? *FString::Printf(TEXT("%.3f"), BaselineMs) : TEXT("-"),
+				BaselineMs > 0 ? *FString::Printf(TEXT("%+.1f%%"), Delta * 100) : TEXT("-"),
+				bHasBaseline ? *Status : TEXT(""));
+		}
+	}
+
+	const TSharedPtr<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetNumberField(TEXT("Version"), 1);
+
+	if (const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("PCGExtendedToolkit")))
+	{
+		Root->SetStringField(TEXT("Plugin"), Plugin->GetDescriptor().VersionName);
+	}
+
+	Root->SetStringField(TEXT("Platform"), FPlatformProperties::IniPlatformName());
+	Root->SetStringField(TEXT("CPU"), FPlatformMisc::GetCPUBrand().TrimStartAndEnd());
+	Root->SetNumberField(TEXT("Cores"), FPlatformMisc::NumberOfCoresIncludingHyperthreads());
+	Root->SetNumberField(TEXT("Iterations"), Iterations);
+	Root->SetArrayField(TEXT("Results"), JsonResults);
+
+	FString Json;
+	FJsonSerializer::Serialize(Root.ToSharedRef(), TJsonWriterFactory<>::Create(&Json));
+
+	if (!FFileHelper::SaveStringToFile(Json, *OutputPath))
+	{
+		UE_LOG(LogPCGEx, Error, TEXT("PCGExBenchmark : could not write results to '%s'."), *OutputPath);
+		return 1;
+	}
+
+	UE_LOG(LogPCGEx, Display, TEXT("PCGExBenchmark : %d results written to '%s'."), JsonResults.Num(), *OutputPath);
+
+	if (NumRegressed > 0)
+	{
+		UE_LOG(LogPCGEx, Error, TEXT("PCGExBenchmark : %d case(s) regressed by more than %.0f%% against '%s'."), NumRegressed, Tolerance * 100, *BaselinePath);
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,98 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/StrongObjectPtr.h"
+
+struct FPCGExContext;
+class UPCGBasePointData;
+
+namespace PCGExMT
+{
+	class FTaskManager;
+}
+
+namespace PCGExBenchmark
+{
+	/**
+	 * Deterministic synthetic inputs. The same seed and size always produce the same data,
+	 * so timings from different runs (and machines) measure the same work.
+	 */
+	namespace Inputs
+	{
+		/** Uniform random positions inside a cube sized to keep density constant across scales. */
+		PCGEXTENDEDTOOLKITEDITOR_API void PointCloud(const int32 NumPoints, const int32 Seed, TArray<FVector>& OutPositions);
+
+		/** Square grid with 4-connected edges, packed as H64U(A, B) point indices. */
+		PCGEXTENDEDTOOLKITEDITOR_API void Grid(const int32 NumPoints, TArray<FVector>& OutPositions, TArray<uint64>& OutEdges);
+
+		/** Random point cloud and its 3D Delaunay edges, packed as H64U(A, B) point indices. */
+		PCGEXTENDEDTOOLKITEDITOR_API bool Delaunay(const int32 NumPoints, const int32 Seed, TArray<FVector>& OutPositions, TArray<uint64>& OutEdges);
+
+		/** Random lattice walks that overlap each other, totalling roughly NumPoints points. */
+		PCGEXTENDEDTOOLKITEDITOR_API void Paths(const int32 NumPoints, const int32 Seed, TArray<TArray<FVector>>& OutPaths);
+	}
+
+	/**
+	 * Standalone execution environment for benchmark cases.
+	 * Owns a context that isn't attached to any graph, and keeps generated point data alive.
+	 */
+	class PCGEXTENDEDTOOLKITEDITOR_API FEnvironment
+	{
+	public:
+		FEnvironment();
+		~FEnvironment();
+
+		FPCGExContext* GetContext() const { return Context.Get(); }
+
+		/** Point data with one point per position, with metadata entries so attributes can be written. */
+		UPCGBasePointData* NewPointData(TArrayView<const FVector> Positions);
+
+		/** Edge data in the layout FCluster::BuildFrom expects; endpoints are hashed by point index. */
+		UPCGBasePointData* NewEdgeData(TArrayView<const FVector> Positions, TArrayView<const uint64> Edges);
+
+		/** Runs work scheduled on a fresh task manager and blocks until all of it has completed. */
+		void RunAndWait(TFunctionRef<void(const TSharedPtr<PCGExMT::FTaskManager>&)> Schedule) const;
+
+	protected:
+		TUniquePtr<FPCGExContext> Context;
+		TArray<TStrongObjectPtr<UPCGBasePointData>> KeepAlive;
+	};
+
+	struct FRun
+	{
+		/** Restores the state Execute consumes. Untimed, called before every iteration. */
+		TFunction<void()> Reset;
+
+		/** The timed work. */
+		TFunction<void()> Execute;
+	};
+
+	struct FCase
+	{
+		FString Name;
+
+		/** Builds inputs for the given scale and returns the work to time. Untimed. */
+		TFunction<FRun(FEnvironment&, const int32 Scale)> Setup;
+	};
+
+	struct FResult
+	{
+		FString Name;
+		int32 Scale = 0;
+		int32 Iterations = 0;
+		double MinMs = 0;
+		double MedianMs = 0;
+		double MeanMs = 0;
+
+		FString GetKey() const { return FString::Printf(TEXT("%s@%d"), *Name, Scale); }
+		double GetItemsPerSecond() const { return MedianMs > 0 ? Scale / (MedianMs * 0.001) : 0; }
+	};
+
+	PCGEXTENDEDTOOLKITEDITOR_API const TArray<FCase>& GetCases();
+
+	/** Sets the case up, runs one untimed warm-up, then times Iterations runs. */
+	PCGEXTENDEDTOOLKITEDITOR_API FResult Run(FEnvironment& Environment, const FCase& Case, const int32 Scale, const int32 Iterations);
+}
@@ -0,0 +1,29 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+
+#include "PCGExBenchmarkCommandlet.generated.h"
+
+/**
+ * Headless benchmark of PCGEx hot paths on deterministic synthetic inputs.
+ * Writes machine-readable results and, when given a baseline, flags regressions.
+ *
+ * UnrealEditor-Cmd <Project>.uproject -run=PCGExBenchmark [-Scales=1000,10000,100000] [-Iterations=5]
+ *                  [-Filter=Cluster] [-Output=<Path.json>] [-Baseline=<Path.json>] [-Tolerance=0.1]
+ *
+ * Returns non-zero if any case is slower than its baseline median by more than Tolerance.
+ */
+UCLASS()
+class UPCGExBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UPCGExBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};